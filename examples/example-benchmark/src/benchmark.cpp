@@ -0,0 +1,746 @@
+/**
+ * @file benchmark.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "benchmark.h"
+
+#include "ofxPlotCtrl.hpp"
+#include "ofxPlotDispatcher.hpp"
+#include "ofxPlotExport.hpp"
+#include "ofxPlotScheduler.hpp"
+#include "ofxPlotSharedRing.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+#ifndef _WIN32
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- BenchPlot --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a plot that only receives the events the benchmark sends
+ */
+BenchPlot::BenchPlot() : ofxPlot(){
+	disableMouseInput();
+	disableKeyInput();
+	setPosition(0, 0);
+	setSize(1000, 600);
+}//====================================================
+
+/**
+ *  @brief Transform every point and build the paths through them, as the
+ *  CPU draw path does after the transform changes
+ */
+void BenchPlot::buildPath(){
+	invalidateGeometry();
+	for(size_t s = 0; s < series.size(); s++){
+		updateDisplayData(series[s]);
+	}
+}//====================================================
+
+/**
+ *  @brief Recompute the data extents of every series from scratch
+ */
+void BenchPlot::computeExtents(){
+	for(size_t s = 0; s < series.size(); s++){
+		series[s].updateExtents();
+	}
+}//====================================================
+
+/**
+ *  @brief Compute the plot area and the data transform
+ */
+void BenchPlot::computeTransform(){ updateTransform(); }
+
+/**
+ *  @brief Decimate all of series 0 with the plot's transform
+ *  @param decimator decimator to use; its previous output is discarded
+ */
+void BenchPlot::decimate(ofxPlotDecimator &decimator) const{
+	decimator.reset(dataOrigin, xScale, yScale);
+	decimator.add(series[0].data, series[0].data.size());
+	decimator.finish();
+}//====================================================
+
+/**
+ *  @brief Drag a selection rectangle between two points
+ *  @param from point where the mouse was pressed, screen coordinates
+ *  @param to point the mouse was dragged to, screen coordinates
+ */
+void BenchPlot::drag(const ofVec2f &from, const ofVec2f &to){
+	isMousePressedInside = true;
+	mousePressedPt = from;
+
+	ofMouseEventArgs args(ofMouseEventArgs::Dragged, to.x, to.y);
+	mouseDragged(args);
+
+	isMousePressedInside = false;
+	selectedArea = ofRectangle(0,0,0,0);
+}//====================================================
+
+/**
+ *  @brief Move the mouse with the inspect key held, which looks up the
+ *  nearest point
+ *  @param pt mouse location, screen coordinates
+ */
+void BenchPlot::hover(const ofVec2f &pt){
+	heldKey = 'i';
+	ofMouseEventArgs args(ofMouseEventArgs::Moved, pt.x, pt.y);
+	mouseMoved(args);
+}//====================================================
+
+/**
+ *  @brief Transform every point of series 0 into screen coordinates
+ *  @param out screen coordinates; resized to fit
+ */
+void BenchPlot::transformAll(std::vector<ofVec2f> &out) const{
+	const std::vector<dataPt> &data = series[0].data;
+	out.resize(data.size());
+	for(size_t i = 0; i < data.size(); i++){
+		out[i] = dataToScreen(data[i]);
+	}
+}//====================================================
+
+/**
+ *  @brief Block until the background geometry matches the data
+ *  @see ofxPlot::setAsyncGeometry()
+ */
+void BenchPlot::waitForGeometry(){
+	prepare();
+	while(pendingGeometry.valid() || !frontGeometry){
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		prepare();
+	}
+}//====================================================
+
+/**
+ *  @brief Retrieve the area within the axes
+ *  @return the plot area, screen coordinates
+ */
+ofRectangle BenchPlot::getPlotArea() const { return plotArea; }
+
+/**
+ *  @brief Retrieve the data of series 0
+ *  @return the data points
+ */
+const std::vector<dataPt>& BenchPlot::getData() const { return series[0].data; }
+
+/**
+ *  @brief Describe the plot's data and transform as the input to a
+ *  background geometry build
+ *  @details The data are copied
+ *  @return the build input
+ */
+ofxPlotGeometry::Input BenchPlot::getGeometryInput() const{
+	ofxPlotGeometry::Input input;
+	for(size_t s = 0; s < series.size(); s++){
+		input.data.push_back(std::make_shared<const std::vector<dataPt> >(series[s].data));
+		input.fill.push_back(series[s].fillPlot);
+	}
+	input.plotArea = plotArea;
+	input.xScale = xScale;
+	input.yScale = yScale;
+	input.dataOrigin = dataOrigin;
+	input.dataVersion = dataVersion;
+	return input;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Benchmark --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Read the command line options
+ *  @details Options:
+ *  - --headless: only run the CPU kernels; no OpenGL context is created
+ *  - --min-size N, --max-size N: range of series sizes, swept by decades
+ *  - --max-heavy-size N: largest size for benchmarks that copy the data or
+ *  build a path through it
+ *  - --reps N: number of timed repetitions of each benchmark
+ *  - --out PATH: file to write the JSON results to
+ *  - --replay PATH: input recording to replay (see ofxPlotInputRecording)
+ *  - --replay-plot X Y W H: plot viewport the recording was made with;
+ *  defaults to the plot in example-demo
+ *  - --replay-ctrl X Y W H: ofxPlotCtrl viewport the recording was made
+ *  with, if it included one
+ *  - --export N: number of plots to export (see ofxPlotExport)
+ *  - --export-size N: number of points in each exported plot
+ *  - --export-dir PATH: folder the exported files are written to
+ *  - --ring N: number of samples to stream through a shared memory ring
+ *  (see ofxPlotSharedRing)
+ *  - --ring-capacity N: capacity of the ring, samples
+ *  - --ring-batch N: number of samples the producer publishes at a time
+ * 
+ *  @param argc number of arguments
+ *  @param argv arguments
+ *  @return whether or not the options are valid
+ */
+bool Benchmark::parseArgs(int argc, char *argv[]){
+	for(int i = 1; i < argc; i++){
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if(arg == "--headless"){
+			bHeadless = true;
+		}else if(arg == "--min-size" && hasValue){
+			minSize = (size_t)std::atof(argv[++i]);
+		}else if(arg == "--max-size" && hasValue){
+			maxSize = (size_t)std::atof(argv[++i]);
+		}else if(arg == "--max-heavy-size" && hasValue){
+			maxHeavySize = (size_t)std::atof(argv[++i]);
+		}else if(arg == "--reps" && hasValue){
+			reps = std::max(1, std::atoi(argv[++i]));
+		}else if(arg == "--out" && hasValue){
+			outPath = argv[++i];
+		}else if(arg == "--replay" && hasValue){
+			replayPath = argv[++i];
+		}else if(arg == "--export" && hasValue){
+			numExports = (size_t)std::atof(argv[++i]);
+		}else if(arg == "--export-size" && hasValue){
+			exportSize = (size_t)std::atof(argv[++i]);
+		}else if(arg == "--export-dir" && hasValue){
+			exportDir = argv[++i];
+		}else if(arg == "--ring" && hasValue){
+			ringSamples = (size_t)std::atof(argv[++i]);
+		}else if(arg == "--ring-capacity" && hasValue){
+			ringCapacity = std::max<size_t>(1, (size_t)std::atof(argv[++i]));
+		}else if(arg == "--ring-batch" && hasValue){
+			ringBatch = std::max<size_t>(1, (size_t)std::atof(argv[++i]));
+		}else if((arg == "--replay-plot" || arg == "--replay-ctrl") && i + 4 < argc){
+			ofRectangle &r = arg == "--replay-plot" ? replayPlotArea : replayCtrlArea;
+			r.x = std::atof(argv[++i]);
+			r.y = std::atof(argv[++i]);
+			r.width = std::atof(argv[++i]);
+			r.height = std::atof(argv[++i]);
+		}else{
+			ofLogError("benchmark") << "Unknown or incomplete option " << arg;
+			return false;
+		}
+	}
+
+	if(minSize == 0 || minSize > maxSize){
+		ofLogError("benchmark") << "Invalid size range [" << minSize << ", " << maxSize << "]";
+		return false;
+	}
+	return true;
+}//====================================================
+
+/**
+ *  @brief Time the CPU kernels at every series size
+ */
+void Benchmark::runKernels(){
+	std::vector<size_t> sizes = getSizes();
+	for(size_t k = 0; k < sizes.size(); k++){
+		size_t n = sizes[k];
+		bool heavy = n <= maxHeavySize;
+
+		BenchPlot plot;
+		measure("ingest", n, n, 1, [&](){ fill(plot, n); });
+		plot.computeTransform();
+
+		measure("extents", n, 1, reps, [&](){ plot.computeExtents(); });
+		measure("transform", n, 1, reps, [&](){ plot.computeTransform(); });
+
+		std::vector<ofVec2f> screen;
+		measure("transform_points", n, 1, reps, [&](){ plot.transformAll(screen); });
+		std::vector<ofVec2f>().swap(screen);
+
+		if(heavy)
+			measure("path_build", n, 1, reps, [&](){ plot.buildPath(); });
+		else
+			skip("path_build", n, "larger than --max-heavy-size");
+
+		ofxPlotDecimator decimator;
+		measure("decimate", n, 1, reps, [&](){ plot.decimate(decimator); });
+
+		if(heavy){
+			ofxPlotGeometry::Input input = plot.getGeometryInput();
+			measure("geometry_build", n, 1, reps, [&](){ ofxPlotGeometry::build(input); });
+		}else{
+			skip("geometry_build", n, "larger than --max-heavy-size");
+		}
+
+		ofRectangle area = plot.getPlotArea();
+
+		// Pointer locations are drawn from the plot area
+		const size_t hovers = 32;
+		std::uniform_real_distribution<float> px(area.x, area.x + area.width), py(area.y, area.y + area.height);
+		std::vector<ofVec2f> pts(hovers);
+		for(size_t i = 0; i < hovers; i++){
+			pts[i] = ofVec2f(px(rng), py(rng));
+		}
+
+		ofVec2f dragFrom(area.x + 0.25*area.width, area.y + 0.25*area.height);
+		ofVec2f dragTo(area.x + 0.75*area.width, area.y + 0.75*area.height);
+
+		measure("hover", n, hovers, reps, [&](){
+			for(size_t i = 0; i < hovers; i++){ plot.hover(pts[i]); }
+		});
+		measure("drag", n, 1, reps, [&](){ plot.drag(dragFrom, dragTo); });
+
+		if(heavy){
+			plot.setAsyncGeometry(true);
+			plot.waitForGeometry();
+			measure("hover_indexed", n, hovers, reps, [&](){
+				for(size_t i = 0; i < hovers; i++){ plot.hover(pts[i]); }
+			});
+			measure("drag_indexed", n, 1, reps, [&](){ plot.drag(dragFrom, dragTo); });
+			plot.setAsyncGeometry(false);
+		}else{
+			skip("hover_indexed", n, "larger than --max-heavy-size");
+			skip("drag_indexed", n, "larger than --max-heavy-size");
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Time the full draw path, for each plot style, at every series size
+ *  @details Requires an OpenGL context. Each style is timed once from a cold
+ *  start (including uploads and cache builds), then repeatedly; glFinish() is
+ *  included in each sample so that the GPU work is counted.
+ */
+void Benchmark::runDraw(){
+	ofFbo fbo;
+	fbo.allocate(1000, 600, GL_RGBA);
+
+	std::shared_ptr<ofxPlotScheduler> scheduler = std::make_shared<ofxPlotScheduler>();
+
+	struct Mode{
+		std::string name;
+		ofxPlotStyle style;
+		bool gpu, async, progressive, heavy;
+	};
+	const Mode modes[] = {
+		{"draw_cpu", ofxPlotStyle::LINE, false, false, false, true},
+		{"draw_gpu", ofxPlotStyle::LINE, true, false, false, false},
+		{"draw_scatter", ofxPlotStyle::SCATTER, false, false, false, false},
+		{"draw_density", ofxPlotStyle::DENSITY, false, false, false, false},
+		{"draw_async", ofxPlotStyle::LINE, false, true, false, true},
+		{"draw_progressive", ofxPlotStyle::LINE, false, false, true, false}
+	};
+
+	std::vector<size_t> sizes = getSizes();
+	for(size_t k = 0; k < sizes.size(); k++){
+		size_t n = sizes[k];
+		BenchPlot plot;
+		fill(plot, n);
+
+		for(size_t m = 0; m < sizeof(modes)/sizeof(modes[0]); m++){
+			const Mode &mode = modes[m];
+			if(mode.heavy && n > maxHeavySize){
+				skip(mode.name, n, "larger than --max-heavy-size");
+				continue;
+			}
+
+			plot.setPlotStyle(mode.style);
+			plot.setGPUTransform(mode.gpu);
+			plot.setAsyncGeometry(mode.async);
+			plot.setScheduler(mode.progressive ? scheduler : nullptr);
+
+			std::function<void()> frame = [&](){
+				scheduler->beginFrame();
+				fbo.begin();
+				ofClear(0, 0, 0, 255);
+				plot.draw();
+				fbo.end();
+				glFinish();
+			};
+
+			measure(mode.name + "_first", n, 1, 1, frame);
+			if(mode.async)
+				plot.waitForGeometry();
+			measure(mode.name, n, 1, reps, frame);
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Time the export of many plots to SVG, to PNG with the software
+ *  rasterizer, and, with a context, to PNG with OpenGL
+ *  @details Each format is exported once on a single thread, by calling
+ *  ofxPlotExport::saveSVG(), saveRasterPNG(), or savePNG() for each plot, and
+ *  once with ofxPlotExport::exportAll(). Each sample is the time per plot;
+ *  its inverse is the throughput in plots per second. The benchmark plots
+ *  have no font, so the rasterized images have no text.
+ */
+void Benchmark::runExport(){
+	if(numExports == 0)
+		return;
+
+	ofDirectory::createDirectory(exportDir, true, true);
+
+	std::vector<std::unique_ptr<BenchPlot> > plots;
+	for(size_t i = 0; i < numExports; i++){
+		plots.push_back(std::unique_ptr<BenchPlot>(new BenchPlot()));
+		fill(*plots.back(), exportSize);
+		plots.back()->setTitle("Plot " + ofToString(i));
+	}
+
+	std::vector<std::string> formats;
+	formats.push_back("svg");
+	formats.push_back("raster");
+	if(!bHeadless)
+		formats.push_back("png");
+
+	for(size_t f = 0; f < formats.size(); f++){
+		const std::string &format = formats[f];
+		bool bRaster = format == "raster";
+		std::string suffix = bRaster ? "_raster.png" : "." + format;
+
+		std::vector<ofxPlotExport::Job> jobs(numExports);
+		for(size_t i = 0; i < numExports; i++){
+			jobs[i].plot = plots[i].get();
+			jobs[i].path = ofFilePath::join(exportDir, "plot_" + ofToString(i) + suffix);
+		}
+
+		measure("export_" + format + "_serial", exportSize, numExports, 1, [&](){
+			for(size_t i = 0; i < jobs.size(); i++){
+				if(format == "svg")
+					ofxPlotExport::saveSVG(*jobs[i].plot, jobs[i].path);
+				else if(bRaster)
+					ofxPlotExport::saveRasterPNG(*jobs[i].plot, jobs[i].path);
+				else
+					ofxPlotExport::savePNG(*jobs[i].plot, jobs[i].path);
+			}
+		});
+
+		ofxPlotExport exporter;
+		exporter.setSoftwareRendering(bRaster);
+		ofxPlotExport::Report report;
+		measure("export_" + format, exportSize, numExports, 1, [&](){ report = exporter.exportAll(jobs); });
+		ofLogNotice("benchmark") << "export " << format << " n=" << exportSize << ": " << report.toString();
+	}
+}//====================================================
+
+/**
+ *  @brief Replay the input recording into a plot at every series size
+ *  @details The plot (and control, if the recording had one) are laid out
+ *  as they were when the recording was made, and the mouse events are
+ *  routed through a dispatcher as in example-demo. The recording is
+ *  replayed with and without coalesced input; each event is one sample of
+ *  the replay_<event> (or replay_coalesced_<event>) benchmark, where the
+ *  frame events time update(), which handles the coalesced input.
+ */
+void Benchmark::runReplay(){
+	if(replayPath.empty())
+		return;
+
+	ofxPlotInputRecording recording;
+	if(!recording.load(replayPath)){
+		ofLogError("benchmark") << "Could not load the input recording " << replayPath;
+		return;
+	}
+
+	std::vector<size_t> sizes = getSizes();
+	for(size_t k = 0; k < sizes.size(); k++){
+		size_t n = sizes[k];
+		if(n > maxHeavySize){
+			skip("replay", n, "larger than --max-heavy-size");
+			continue;
+		}
+
+		ofxPlotDispatcher dispatcher;
+		BenchPlot plot;
+		fill(plot, n);
+		plot.setPosition(replayPlotArea.x, replayPlotArea.y);
+		plot.setSize(replayPlotArea.width, replayPlotArea.height);
+		plot.enableMouseInput();
+		plot.enableKeyInput();
+		dispatcher.add(&plot);
+
+		std::vector<InteractiveObj*> objs(1, &plot);
+
+		ofxPlotCtrl ctrl;
+		float lower = 0, upper = n - 1;
+		if(replayCtrlArea.width > 0 && replayCtrlArea.height > 0){
+			std::vector<double> t(n);
+			for(size_t i = 0; i < n; i++){ t[i] = (double)i; }
+			ctrl.setData(t);
+			ctrl.setLink_lowerLimit(&lower);
+			ctrl.setLink_upperLimit(&upper);
+			ctrl.setPosition(replayCtrlArea.x, replayCtrlArea.y);
+			ctrl.setSize(replayCtrlArea.width, replayCtrlArea.height);
+			ctrl.enableMouseInput();
+			dispatcher.add(&ctrl);
+			objs.push_back(&ctrl);
+		}
+
+		plot.computeTransform();
+		for(int coalesce = 0; coalesce < 2; coalesce++){
+			plot.setCoalesceInput(coalesce == 1);
+			ofxPlotInputRecording::Report report = recording.replay(objs, &dispatcher);
+
+			for(int t = 0; t < ofxPlotInputRecording::NUM_TYPES; t++){
+				ofxPlotInputRecording::Type type = (ofxPlotInputRecording::Type)t;
+				const std::vector<uint64_t> &lat = report.getLatencies(type);
+				if(lat.empty())
+					continue;
+
+				BenchResult res;
+				res.name = std::string(coalesce ? "replay_coalesced_" : "replay_") + ofxPlotInputRecording::getName(type);
+				res.size = n;
+				for(size_t i = 0; i < lat.size(); i++){
+					res.samples.push_back(lat[i]/1000.0);
+				}
+				results.push_back(res);
+			}
+			ofLogNotice("benchmark") << "replay n=" << n << (coalesce ? " (coalesced)" : "") << "\n" << report.toString();
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Stream samples from a producer process into a plot through a
+ *  shared memory ring
+ *  @details A child process publishes --ring samples as fast as it can, in
+ *  batches of --ring-batch, while the plot attached to the ring is updated
+ *  in a loop. Sample i is (i, -i/2), so the plot's data can be checked
+ *  afterward: the x values must increase, any gap is a dropped sample, and
+ *  any other value is a torn read. For comparison, the same samples are
+ *  added to a plot one at a time with addDataPt(). Each sample is the time
+ *  per streamed sample, including the time spent waiting for the producer.
+ */
+void Benchmark::runSharedRing(){
+	if(ringSamples == 0)
+		return;
+
+	BenchPlot baseline;
+	measure("ring_baseline", ringSamples, ringSamples, 1, [&](){
+		for(size_t i = 0; i < ringSamples; i++){
+			baseline.addDataPt((double)i, -0.5*i);
+		}
+	});
+
+#ifdef _WIN32
+	skip("ring_stream", ringSamples, "shared memory rings are not supported on Windows");
+#else
+	std::string name = "/ofxPlot-benchmark-" + ofToString(getpid());
+	ofxPlotSharedRing producer;
+	if(!producer.create(name, ringCapacity)){
+		ofLogError("benchmark") << producer.getError();
+		skip("ring_stream", ringSamples, producer.getError());
+		return;
+	}
+
+	BenchPlot plot;
+	plot.attachSharedRing(name);
+
+	pid_t pid = fork();
+	if(pid == 0){
+		std::vector<double> xs(ringBatch), ys(ringBatch);
+		for(size_t first = 0; first < ringSamples; first += ringBatch){
+			size_t n = std::min(ringBatch, ringSamples - first);
+			for(size_t i = 0; i < n; i++){
+				xs[i] = (double)(first + i);
+				ys[i] = -0.5*(first + i);
+			}
+			producer.publish(xs.data(), ys.data(), n);
+		}
+		_exit(0);
+	}
+	producer.close();
+
+	if(pid < 0){
+		ofLogError("benchmark") << "Could not start the producer process";
+		skip("ring_stream", ringSamples, "fork failed");
+		ofxPlotSharedRing::remove(name);
+		return;
+	}
+
+	size_t numUpdates = 0;
+	measure("ring_stream", ringSamples, ringSamples, 1, [&](){
+		bool bProducerDone = false;
+		while(true){
+			plot.update();
+			numUpdates++;
+
+			const std::vector<dataPt> &data = plot.getData();
+			if(bProducerDone || (!data.empty() && data.back().indVar >= ringSamples - 1))
+				break;
+
+			int status = 0;
+			bProducerDone = waitpid(pid, &status, WNOHANG) == pid;	// Read once more, then stop
+		}
+	});
+	ofxPlotSharedRing::remove(name);
+
+	const std::vector<dataPt> &data = plot.getData();
+	size_t numCorrupt = 0;
+	for(size_t i = 0; i < data.size(); i++){
+		if(data[i].depVar != -0.5*data[i].indVar || (i > 0 && data[i].indVar <= data[i - 1].indVar))
+			numCorrupt++;
+	}
+
+	ofLogNotice("benchmark") << "ring: " << data.size() << "/" << ringSamples << " samples read in " << numUpdates
+		<< " updates; " << ringSamples - data.size() << " dropped, " << numCorrupt << " corrupt";
+	if(numCorrupt > 0)
+		ofLogError("benchmark") << "ring: " << numCorrupt << " samples were corrupt";
+#endif
+}//====================================================
+
+/**
+ *  @brief Write the results to the output file as JSON
+ *  @details Each result lists its name, series size, and either the reason
+ *  it was skipped or summary statistics of the time per operation, in
+ *  microseconds, along with the raw samples
+ *  @return whether or not the file was written
+ */
+bool Benchmark::writeJSON() const{
+	std::ofstream out(outPath.c_str());
+	if(!out){
+		ofLogError("benchmark") << "Could not open " << outPath << " for writing";
+		return false;
+	}
+
+	out << "{\n";
+	out << "  \"benchmark\": \"ofxPlot\",\n";
+	out << "  \"mode\": \"" << (bHeadless ? "headless" : "gl") << "\",\n";
+	out << "  \"threads\": " << std::thread::hardware_concurrency() << ",\n";
+	out << "  \"reps\": " << reps << ",\n";
+	out << "  \"results\": [\n";
+	for(size_t r = 0; r < results.size(); r++){
+		const BenchResult &res = results[r];
+		out << "    {\"name\": \"" << res.name << "\", \"size\": " << res.size;
+
+		if(!res.skipped.empty()){
+			out << ", \"skipped\": \"" << res.skipped << "\"}";
+		}else{
+			std::vector<double> sorted = res.samples;
+			std::sort(sorted.begin(), sorted.end());
+			double sum = 0;
+			for(size_t i = 0; i < sorted.size(); i++){
+				sum += sorted[i];
+			}
+
+			out << ", \"ops\": " << res.ops;
+			out << ", \"min_us\": " << sorted.front();
+			out << ", \"median_us\": " << sorted[sorted.size()/2];
+			out << ", \"p90_us\": " << sorted[std::min(sorted.size() - 1, (size_t)(0.9*sorted.size()))];
+			out << ", \"p99_us\": " << sorted[std::min(sorted.size() - 1, (size_t)(0.99*sorted.size()))];
+			out << ", \"mean_us\": " << sum/sorted.size();
+			out << ", \"max_us\": " << sorted.back();
+			out << ", \"samples_us\": [";
+			for(size_t i = 0; i < res.samples.size(); i++){
+				out << (i > 0 ? ", " : "") << res.samples[i];
+			}
+			out << "]}";
+		}
+		out << (r + 1 < results.size() ? ",\n" : "\n");
+	}
+	out << "  ]\n}\n";
+
+	ofLogNotice("benchmark") << "Wrote " << results.size() << " results to " << outPath;
+	return true;
+}//====================================================
+
+/**
+ *  @brief Determine whether only the CPU kernels should run
+ *  @return whether or not the benchmark runs without an OpenGL context
+ */
+bool Benchmark::isHeadless() const { return bHeadless; }
+
+/**
+ *  @brief Fill a plot with a noisy random walk
+ *  @param plot plot to fill; its data are cleared first
+ *  @param n number of points
+ */
+void Benchmark::fill(BenchPlot &plot, size_t n){
+	std::normal_distribution<double> step(0, 1);
+	plot.clearData();
+
+	double y = 0;
+	for(size_t i = 0; i < n; i++){
+		y += step(rng);
+		plot.addDataPt((double)i, y);
+	}
+}//====================================================
+
+/**
+ *  @brief Determine the series sizes to sweep
+ *  @return sizes from minSize to maxSize, by factors of ten
+ */
+std::vector<size_t> Benchmark::getSizes() const{
+	std::vector<size_t> sizes;
+	for(size_t n = minSize; n <= maxSize; n *= 10){
+		sizes.push_back(n);
+		if(n > maxSize/10)
+			break;
+	}
+	return sizes;
+}//====================================================
+
+/**
+ *  @brief Time a benchmark and record the result
+ * 
+ *  @param name name of the benchmark
+ *  @param n series size
+ *  @param ops number of operations performed by each call to fn
+ *  @param count number of timed repetitions
+ *  @param fn work to time
+ */
+void Benchmark::measure(const std::string &name, size_t n, size_t ops, int count, const std::function<void()> &fn){
+
+	BenchResult res;
+	res.name = name;
+	res.size = n;
+	res.ops = std::max<size_t>(ops, 1);
+
+	for(int i = 0; i < count; i++){
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		fn();
+		double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		res.samples.push_back(us/res.ops);
+	}
+
+	std::vector<double> sorted = res.samples;
+	std::sort(sorted.begin(), sorted.end());
+	ofLogNotice("benchmark") << name << " n=" << n << ": " << sorted[sorted.size()/2] << " us/op (median)";
+
+	results.push_back(res);
+}//====================================================
+
+/**
+ *  @brief Record a benchmark that was not run
+ * 
+ *  @param name name of the benchmark
+ *  @param n series size
+ *  @param reason why the benchmark was skipped
+ */
+void Benchmark::skip(const std::string &name, size_t n, const std::string &reason){
+	BenchResult res;
+	res.name = name;
+	res.size = n;
+	res.skipped = reason;
+	results.push_back(res);
+}//====================================================
@@ -0,0 +1,127 @@
+/**
+ * @file benchmark.h
+ * @brief Timing harness for the ofxPlot hot paths
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+#include "ofxPlot.hpp"
+#include "ofxPlotDecimator.hpp"
+#include "ofxPlotInputRecording.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ *  @brief Plot that exposes its internal kernels to the benchmark
+ */
+class BenchPlot : public ofxPlot{
+public:
+	BenchPlot();
+
+	void buildPath();
+	void computeExtents();
+	void computeTransform();
+	void decimate(ofxPlotDecimator&) const;
+	void drag(const ofVec2f&, const ofVec2f&);
+	void hover(const ofVec2f&);
+	void transformAll(std::vector<ofVec2f>&) const;
+	void waitForGeometry();
+
+	ofRectangle getPlotArea() const;
+	const std::vector<dataPt>& getData() const;
+	ofxPlotGeometry::Input getGeometryInput() const;
+};
+
+/**
+ *  @brief Timings of a single benchmark at a single series size
+ */
+struct BenchResult{
+	std::string name;				//!< Name of the benchmark
+	size_t size = 0;				//!< Number of points in the series
+	size_t ops = 1;					//!< Number of operations timed by each sample
+	std::vector<double> samples;	//!< Time per operation for each repetition, microseconds
+	std::string skipped = "";		//!< Reason the benchmark was skipped; empty if it ran
+};
+
+/**
+ *  @brief Sweeps series sizes and times the ofxPlot hot paths at each size
+ *  @details The CPU kernels (extents, transform, path building, decimation,
+ *  background geometry, hover lookup, and rectangle selection) need no OpenGL
+ *  context and are run by runKernels(). The draw path, for each plot style,
+ *  needs a context and is run by runDraw(); it renders into an FBO so that no
+ *  visible window is required. A recording of user input, made with
+ *  ofxPlotInputRecording, is replayed into a plot at every size by
+ *  runReplay(), which also needs no context. The batch export of many plots
+ *  is timed by runExport(); SVG and software-rasterized PNG export need no
+ *  context, OpenGL PNG export does. runSharedRing() streams samples from a
+ *  producer process into a plot through a shared memory ring and checks
+ *  that every sample arrives intact.
+ *  Results are written as JSON by writeJSON().
+ */
+class Benchmark{
+public:
+	bool parseArgs(int, char*[]);
+
+	void runKernels();
+	void runDraw();
+	void runExport();
+	void runReplay();
+	void runSharedRing();
+	bool writeJSON() const;
+
+	bool isHeadless() const;
+
+protected:
+	size_t minSize = 1000;			//!< Smallest series size
+	size_t maxSize = 100000000;		//!< Largest series size
+	size_t maxHeavySize = 10000000;	//!< Largest size for benchmarks that copy the data or build a path through it
+	int reps = 5;					//!< Number of timed repetitions of each benchmark
+	bool bHeadless = false;			//!< Whether or not to skip the benchmarks that need an OpenGL context
+	std::string outPath = "ofxPlot-benchmark.json";	//!< File the results are written to
+	std::string replayPath = "";	//!< Input recording to replay; empty to skip the replay benchmarks
+	ofRectangle replayPlotArea = ofRectangle(270, 270, 600, 200);	//!< Plot viewport the recording was made with (example-demo's by default)
+	ofRectangle replayCtrlArea = ofRectangle(0, 0, 0, 0);	//!< Control viewport the recording was made with; empty if there was no control
+	size_t numExports = 0;			//!< Number of plots to export; zero to skip the export benchmarks
+	size_t exportSize = 10000;		//!< Number of points in each exported plot
+	std::string exportDir = "export";	//!< Folder the exported files are written to
+	size_t ringSamples = 0;			//!< Number of samples to stream through a shared ring; zero to skip the ring benchmarks
+	size_t ringCapacity = 1 << 20;	//!< Capacity of the shared ring, samples
+	size_t ringBatch = 1024;		//!< Number of samples the producer publishes at a time
+
+	std::vector<BenchResult> results;	//!< Results, in the order they were measured
+	std::mt19937 rng;					//!< Generates the synthetic data and pointer locations
+
+	void fill(BenchPlot&, size_t);
+	std::vector<size_t> getSizes() const;
+	void measure(const std::string&, size_t, size_t, int, const std::function<void()>&);
+	void skip(const std::string&, size_t, const std::string&);
+};
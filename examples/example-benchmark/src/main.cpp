@@ -0,0 +1,35 @@
+#include "ofMain.h"
+#include "ofApp.h"
+#include "benchmark.h"
+
+/*
+ *  Usage: example-benchmark [--headless] [--min-size N] [--max-size N]
+ *         [--max-heavy-size N] [--reps N] [--out results.json]
+ *         [--replay recording.txt [--replay-plot X Y W H] [--replay-ctrl X Y W H]]
+ *         [--export N [--export-size N] [--export-dir PATH]]
+ *         [--ring N [--ring-capacity N] [--ring-batch N]]
+ *
+ *  With --headless, only the CPU kernels (and the input replay, if a recording
+ *  is given, the SVG and software-rasterized PNG export, if a number of
+ *  plots is given, and the shared ring stream, if a number of samples is
+ *  given) are timed and no window is created.
+ *  Otherwise, the draw path is timed too; on a machine without a display, run
+ *  under a virtual X server with Mesa's software renderer, e.g.,
+ *      LIBGL_ALWAYS_SOFTWARE=1 xvfb-run -s "-screen 0 1280x1024x24" ./example-benchmark
+ */
+int main(int argc, char *argv[]){
+	Benchmark bench;
+	if(!bench.parseArgs(argc, argv))
+		return 1;
+
+	if(bench.isHeadless()){
+		bench.runKernels();
+		bench.runReplay();
+		bench.runExport();
+		bench.runSharedRing();
+		return bench.writeJSON() ? 0 : 1;
+	}
+
+	ofSetupOpenGL(1024,768, OF_WINDOW);
+	ofRunApp(new ofApp(bench));
+}//====================================================
@@ -0,0 +1,58 @@
+/**
+ * @file ofApp.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofApp.h"
+
+/**
+ *  @brief Construct the app
+ *  @param b benchmark to run
+ */
+ofApp::ofApp(Benchmark &b) : bench(b){}
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+	ofSetVerticalSync(false);	// Don't let the display rate limit the draw timings
+
+	bench.runKernels();
+	bench.runReplay();
+	bench.runDraw();
+	bench.runExport();
+	bench.runSharedRing();
+	bench.writeJSON();
+
+	ofExit(0);
+}//====================================================
+
+//--------------------------------------------------------------
+void ofApp::update(){
+
+}//====================================================
+
+//--------------------------------------------------------------
+void ofApp::draw(){
+
+}//====================================================
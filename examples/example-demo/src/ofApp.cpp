@@ -30,10 +30,12 @@ void ofApp::setup(){
 
 	ofEnableSmoothing();
 
-	ofTrueTypeFont font;
-	font.load("verdana.ttf", 10, true, true);
-    font.setLineHeight(18.0f);
-    font.setLetterSpacing(1.037);
+	// Loaded once and shared by every widget that uses it
+	std::shared_ptr<ofxPlotFont> font = ofxPlotFont::getShared("verdana.ttf", 10);
+	if(font){
+		font->setLineHeight(18.0f);
+		font->setLetterSpacing(1.037);
+	}
 
 	plot.setSize(600, 200);
 	plot.setPosition(270, 270);
@@ -42,6 +44,9 @@ void ofApp::setup(){
 	plot.setTitle("Amplitude Time History");
 	plot.setFont(font);		// Can comment this out to use bitmap strings (not as pretty!)
 	plot.enableMouseInput();
+	dispatcher.add(&plot);	// Only deliver mouse events that occur over the plot
+	plot.setCoalesceInput(true);	// Process at most one hover/selection per frame, in update()
+	widgets.add(&plot);
 
 	// Create some bogus data
 	for(double t = -15; t < 50; t+= 0.05){
@@ -50,15 +55,26 @@ void ofApp::setup(){
 }//====================================================
 
 void ofApp::update(){
-
+	widgets.update();
 }//====================================================
 
 void ofApp::draw(){
-	plot.draw();
+	widgets.draw();
 }//====================================================
 
 void ofApp::keyPressed(int key){
-
+	// Record input for the benchmark example to replay (--replay)
+	if(key == 'R'){
+		if(recording.isRecording()){
+			recording.stop();
+			recording.save("input-recording.txt");
+			ofLogNotice("example-demo") << "Saved " << recording.getEvents().size() << " events to input-recording.txt";
+		}else{
+			recording.clear();
+			recording.start();
+			ofLogNotice("example-demo") << "Recording input; press R again to stop";
+		}
+	}
 }//====================================================
 
 void ofApp::keyReleased(int key){
@@ -28,6 +28,9 @@
 
 #include "ofMain.h"
 #include "ofxPlot.hpp"
+#include "ofxPlotContainer.hpp"
+#include "ofxPlotDispatcher.hpp"
+#include "ofxPlotInputRecording.hpp"
 
 class ofApp : public ofBaseApp{
 
@@ -50,5 +53,8 @@ class ofApp : public ofBaseApp{
 
 	protected:
 
+		ofxPlotDispatcher dispatcher;	// Declared first so that it outlives the plot
+		ofxPlotContainer widgets;		// Updates and prepares the widgets, then draws them
 		ofxPlot plot;
+		ofxPlotInputRecording recording;	// Toggled with 'R'; replay the file with the benchmark example
 };
@@ -1,19 +1,50 @@
 #pragma once
 
 #include "ofMain.h"
+#include "ofxPlotRangeSet.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+class ofxPlotSelectionGroup;
 
 class DataSelectedEventArgs : public ofEventArgs {
 public:
-	DataSelectedEventArgs(){}
+	DataSelectedEventArgs() : indices(std::make_shared<ofxPlotRangeSet>()){}
 	DataSelectedEventArgs(int ix){
-		indices.push_back(ix);
+		std::shared_ptr<ofxPlotRangeSet> set = std::make_shared<ofxPlotRangeSet>();
+		set->add(ix);
+		indices = set;
 	}
+	DataSelectedEventArgs(ofxPlotRangeSet ixs) : indices(std::make_shared<ofxPlotRangeSet>(std::move(ixs))){}
 	
-	std::vector<int> indices;	//!< Indices or IDs of selected data objects
+	/**
+	 * Indices or IDs of selected data objects, stored as ranges. The indices
+	 * are shared, not copied, by every listener that keeps them, and must not
+	 * be modified after the event is sent.
+	 */
+	std::shared_ptr<const ofxPlotRangeSet> indices;
+
+	/**
+	 * Indices added to the selection since the previous version, or nullptr if
+	 * the change is unknown (i.e., the event was not sent by a selection group)
+	 */
+	std::shared_ptr<const ofxPlotRangeSet> added;
+
+	/**
+	 * Indices removed from the selection since the previous version, or nullptr
+	 * if the change is unknown
+	 */
+	std::shared_ptr<const ofxPlotRangeSet> removed;
+
+	uint64_t version = 0;						//!< Selection version within the group; 0 if unversioned
+	ofxPlotSelectionGroup *group = nullptr;		//!< Group the event was sent to
 };
 
 class DataSelectedEvent{
 public:
 	static ofEvent<DataSelectedEventArgs> selected;
 	static ofEvent<DataSelectedEventArgs> deselected;
-};
\ No newline at end of file
+};
@@ -24,7 +24,10 @@
 
 #include "interactiveObj.hpp"
 
-#include "DataSelectedEvent.hpp"
+#include "dataSelectedEvent.hpp"
+#include "ofxPlotBatch.hpp"
+#include "ofxPlotDispatcher.hpp"
+#include "ofxPlotSelectionGroup.hpp"
 
 //-----------------------------------------------------------------------------
 // -- *structors --
@@ -40,8 +43,9 @@ InteractiveObj::InteractiveObj(){
 	if(!areEventsSet)
 		setEvents(ofEvents());
 
-	ofAddListener(DataSelectedEvent::selected, this, &InteractiveObj::dataSelected);
-	ofAddListener(DataSelectedEvent::deselected, this, &InteractiveObj::dataDeselected);
+	selectionGroup = ofxPlotSelectionGroup::getDefault();
+	ofAddListener(selectionGroup->getSelectedEvent(), this, &InteractiveObj::dataSelected);
+	ofAddListener(selectionGroup->getDeselectedEvent(), this, &InteractiveObj::dataDeselected);
 
 	enableMouseInput();
 	enableKeyInput();
@@ -53,8 +57,8 @@ InteractiveObj::InteractiveObj(){
  *  it is destroyed
  */
 InteractiveObj::~InteractiveObj(){
-	ofRemoveListener(DataSelectedEvent::selected, this, &InteractiveObj::dataSelected);
-	ofRemoveListener(DataSelectedEvent::deselected, this, &InteractiveObj::dataDeselected);
+	ofRemoveListener(selectionGroup->getSelectedEvent(), this, &InteractiveObj::dataSelected);
+	ofRemoveListener(selectionGroup->getDeselectedEvent(), this, &InteractiveObj::dataDeselected);
 	
 	disableKeyInput();
 	disableMouseInput();
@@ -80,6 +84,21 @@ void InteractiveObj::setup(){}
  */
 void InteractiveObj::update(){}
 
+/**
+ *  @brief Prepare the object to be drawn
+ *  @details This function performs the CPU-side work needed before drawing,
+ *  e.g., transforming data and building geometry. It is called from draw()
+ *  if necessary, but ofxPlotContainer calls it for many objects in parallel
+ *  after update(), so implementations must follow these rules:
+ *  - Only read and write this object's own state (including objects it owns)
+ *  - Do not make OpenGL calls; leave uploads and drawing to draw()
+ *  - Do not send events or modify other objects, e.g., selection groups
+ *  - Calling it again with nothing changed should be cheap
+ *  
+ *  By default, this function does nothing
+ */
+void InteractiveObj::prepare(){}
+
 /**
  *  @brief Call this function to draw the object.
  *  @details In this base class, this function draws
@@ -87,6 +106,8 @@ void InteractiveObj::update(){}
  *  overridden to provide custom behavior
  */
 void InteractiveObj::draw(){
+	bNeedsRedraw = false;
+
 	ofDisableDepthTest();
 	ofPushStyle();
 	ofSetColor(bgColor);
@@ -101,16 +122,76 @@ void InteractiveObj::draw(){
 	ofEnableDepthTest();
 }//====================================================
 
+/**
+ *  @brief Add the object's simple geometry to a batch, in place of draw()
+ *  @details Objects that support batching add their background, lines, and
+ *  text to the batch and draw everything else in drawUnbatched(). This base
+ *  class adds nothing, so the container falls back to draw().
+ * 
+ *  @param batch batch to add to
+ *  @return whether or not the object was batched; if false, the caller
+ *  must call draw() instead of drawUnbatched()
+ */
+bool InteractiveObj::addToBatch(ofxPlotBatch &batch){
+	(void)batch;
+	return false;
+}//====================================================
+
+/**
+ *  @brief Draw the parts of the object that addToBatch() did not batch
+ *  @details Call this after the batch's fills have been drawn, and only if
+ *  addToBatch() returned true
+ */
+void InteractiveObj::drawUnbatched(){}
+
+/**
+ *  @brief Draw the object from an offscreen cache
+ *  @details The object is prepared, then rendered into a frame buffer only
+ *  when its appearance has changed (see needsRedraw()); otherwise, the frame
+ *  buffer from the previous draw is copied to the screen. Use this in place
+ *  of draw() to avoid re-rendering objects that are idle.
+ */
+void InteractiveObj::drawCached(){
+	ofRectangle area = viewport.getStandardized();
+	int w = std::ceil(area.width), h = std::ceil(area.height);
+	if(w <= 0 || h <= 0)
+		return;
+
+	if(!cacheFbo.isAllocated() || cacheFbo.getWidth() != w || cacheFbo.getHeight() != h){
+		cacheFbo.allocate(w, h, GL_RGBA);
+		OFXPLOT_COUNT(stats, ofxPlotStats::ALLOCATIONS, 1);
+		bNeedsRedraw = true;
+	}
+
+	// Work done while preparing, e.g., finishing background work, may request a redraw
+	prepare();
+	if(needsRedraw()){
+		cacheFbo.begin();
+		ofClear(0, 0);
+		ofPushMatrix();
+		ofTranslate(-area.x, -area.y);
+		draw();
+		ofPopMatrix();
+		cacheFbo.end();
+	}
+
+	cacheFbo.draw(area.x, area.y);
+}//====================================================
+
 
 //-----------------------------------------------------------------------------
 // -- Get and Set --
 //-----------------------------------------------------------------------------
 /**
  *  @brief Enable mouse input for the plot.
- *  @details This allows the user to interact with the plot area
+ *  @details This allows the user to interact with the plot area. Mouse
+ *  events are received from the dispatcher, if one is set, or directly
+ *  from the global events otherwise.
  */
 void InteractiveObj::enableMouseInput(){
-	if(!isMouseInputEnabled && events){
+	if(!isMouseInputEnabled && dispatcher){
+		dispatcher->attach(this);
+	}else if(!isMouseInputEnabled && events){
 		ofAddListener(events->mouseMoved, this, &InteractiveObj::mouseMoved);
 		ofAddListener(events->mousePressed, this, &InteractiveObj::mousePressed);
 		ofAddListener(events->mouseReleased, this, &InteractiveObj::mouseReleased);
@@ -123,7 +204,9 @@ void InteractiveObj::enableMouseInput(){
  *  @brief Disable mouse input for the plot.
  */
 void InteractiveObj::disableMouseInput(){
-	if(isMouseInputEnabled && events){
+	if(isMouseInputEnabled && dispatcher){
+		dispatcher->detach(this);
+	}else if(isMouseInputEnabled && events){
 		ofRemoveListener(events->mouseMoved, this, &InteractiveObj::mouseMoved);
 		ofRemoveListener(events->mousePressed, this, &InteractiveObj::mousePressed);
 		ofRemoveListener(events->mouseReleased, this, &InteractiveObj::mouseReleased);
@@ -160,6 +243,24 @@ void InteractiveObj::disableKeyInput(){
  */
 bool InteractiveObj::isHovered() const { return isMouseInside; }
 
+/**
+ *  @brief Determine whether the object must be redrawn
+ *  @details The flag is set whenever data, appearance, hover state, or the
+ *  viewport change and is cleared each time the object is drawn. While the
+ *  statistics overlay is shown, the object is always redrawn so that the
+ *  overlay stays current.
+ *  @return whether or not the appearance of the object has changed since
+ *  it was last drawn
+ */
+bool InteractiveObj::needsRedraw() const { return bNeedsRedraw || bStatsOverlay; }
+
+/**
+ *  @brief Flag the object to be redrawn
+ *  @details Call this function after modifying the object in a way that
+ *  changes its appearance, e.g., from a derived class
+ */
+void InteractiveObj::requestRedraw(){ bNeedsRedraw = true; }
+
 /**
  *  @brief Retrieve the position of the bounding viewport rectangle
  *  @details Position describes the top-left corner in screen coordinates
@@ -167,12 +268,42 @@ bool InteractiveObj::isHovered() const { return isMouseInside; }
  */
 ofVec2f InteractiveObj::getPosition() const { return viewport.getPosition(); }
 
+/**
+ *  @brief Retrieve the bytes held by this object, broken down by buffer
+ *  @details Derived classes add their own buffers to those of the base
+ *  class. A font shared with other objects is listed as such, and is
+ *  counted by each of them.
+ *  @return the buffers held by this object
+ */
+ofxPlotMemory InteractiveObj::getMemoryUsage() const{
+	ofxPlotMemory mem;
+	if(cacheFbo.isAllocated())
+		mem.add("cache FBO", (size_t)cacheFbo.getWidth()*(size_t)cacheFbo.getHeight()*4, true);
+
+	if(font)
+		mem.add(font.use_count() > 1 ? "font atlas (shared)" : "font atlas", font->getMemoryUsage(), true);
+	return mem;
+}//====================================================
+
 /**
  *  @brief Retrieve the size of the bounding viewport rectangle
  *  @return the size of the bounding viewport rectangle
  */
 ofVec2f InteractiveObj::getSize() const { return ofVec2f(viewport.width, viewport.height); }
 
+/**
+ *  @brief Retrieve the group this object sends and receives selections within
+ *  @return pointer to the selection group
+ */
+std::shared_ptr<ofxPlotSelectionGroup> InteractiveObj::getSelectionGroup() const { return selectionGroup; }
+
+/**
+ *  @brief Retrieve the counters and timers describing the work this object
+ *  does each frame
+ *  @return the statistics
+ */
+const ofxPlotStats& InteractiveObj::getStats() const { return stats; }
+
 /**
  *  @brief Retrieve the bounding viewport rectangle
  *  @return the bounding viewport rectangle
@@ -183,20 +314,96 @@ ofRectangle InteractiveObj::getViewport() const { return viewport; }
  *  @brief Set the background color
  *  @param c background color
  */
-void InteractiveObj::setBGColor(ofColor c){ bgColor = c;}
+void InteractiveObj::setBGColor(ofColor c){ bgColor = c; requestRedraw(); }
+
+/**
+ *  @brief Route this object's mouse events through a dispatcher
+ *  @details Rather than receiving every global mouse event, the object only
+ *  receives events that occur over its viewport, plus the events it needs to
+ *  clear its hover state and to complete a drag that started inside it.
+ *  Derived classes that own other objects should pass the dispatcher on.
+ * 
+ *  @param d pointer to the dispatcher, which must remain in scope while it
+ *  is set, or nullptr to listen to the global mouse events directly
+ *  @see ofxPlotDispatcher
+ */
+void InteractiveObj::setDispatcher(ofxPlotDispatcher *d){
+	if(d == dispatcher)
+		return;
+
+	bool wasEnabled = isMouseInputEnabled;
+	disableMouseInput();
+	dispatcher = d;
+	if(wasEnabled)
+		enableMouseInput();
+}//====================================================
 
 /**
  *  @brief Set the edge/outline color
  *  @param c edge color
  */
-void InteractiveObj::setEdgeColor(ofColor c){ edgeColor = c;}
+void InteractiveObj::setEdgeColor(ofColor c){ edgeColor = c; requestRedraw(); }
 
 /**
  *  @brief Set the font for the plot area
+ *  @details The object keeps its own copy of the font and its glyph atlas;
+ *  to share one font among many objects, use setFont(std::shared_ptr<ofxPlotFont>)
  * 
  *  @param f font to use for the plot
  */
-void InteractiveObj::setFont(ofTrueTypeFont f){ font = f; }
+void InteractiveObj::setFont(ofTrueTypeFont f){ setFont(std::make_shared<ofxPlotFont>(f)); }
+
+/**
+ *  @brief Set the font for the plot area
+ * 
+ *  @param f font to use for the plot, e.g., from ofxPlotFont::getShared();
+ *  nullptr to use bitmap strings
+ */
+void InteractiveObj::setFont(std::shared_ptr<ofxPlotFont> f){ font = f; requestRedraw(); }
+
+/**
+ *  @brief Move this object to a different selection group
+ *  @details The object only receives selections sent within its group, and
+ *  the selections it makes are only sent to that group. The group's current
+ *  selection is applied immediately.
+ * 
+ *  @param group pointer to the group; nullptr selects the default group
+ *  @see ofxPlotSelectionGroup
+ */
+void InteractiveObj::setSelectionGroup(std::shared_ptr<ofxPlotSelectionGroup> group){
+	if(!group)
+		group = ofxPlotSelectionGroup::getDefault();
+
+	if(group == selectionGroup)
+		return;
+
+	ofRemoveListener(selectionGroup->getSelectedEvent(), this, &InteractiveObj::dataSelected);
+	ofRemoveListener(selectionGroup->getDeselectedEvent(), this, &InteractiveObj::dataDeselected);
+
+	selectionGroup = group;
+	selectionVersion = 0;
+	ofAddListener(selectionGroup->getSelectedEvent(), this, &InteractiveObj::dataSelected);
+	ofAddListener(selectionGroup->getDeselectedEvent(), this, &InteractiveObj::dataDeselected);
+
+	// Adopt the group's current selection
+	std::shared_ptr<const ofxPlotSelectionModel> model = selectionGroup->getModel();
+	DataSelectedEventArgs args;
+	args.indices = model->getSelection();
+	args.version = model->getVersion();
+	args.group = selectionGroup.get();
+	dataSelected(args);
+}//====================================================
+
+/**
+ *  @brief Move this object to a named selection group
+ *  @details Objects that are given the same name are linked
+ * 
+ *  @param name name of the group; an empty name selects the default group
+ *  @see setSelectionGroup(std::shared_ptr<ofxPlotSelectionGroup>)
+ */
+void InteractiveObj::setSelectionGroup(std::string name){
+	setSelectionGroup(ofxPlotSelectionGroup::get(name));
+}//====================================================
 
 /**
  *  @brief Set the position of the viewport
@@ -205,7 +412,12 @@ void InteractiveObj::setFont(ofTrueTypeFont f){ font = f; }
  *  @param y pixels, screen coordinates
  */
 void InteractiveObj::setPosition(float x, float y){
+	if(x != viewport.x || y != viewport.y)
+		requestRedraw();
+
 	viewport.setPosition(x, y);
+	if(dispatcher)
+		dispatcher->reindex(this);
 }//====================================================
 
 /**
@@ -225,7 +437,12 @@ void InteractiveObj::setPosition(ofVec2f pos){
  *  @param h height, pixels
  */
 void InteractiveObj::setSize(float w, float h){
+	if(w != viewport.width || h != viewport.height)
+		requestRedraw();
+
 	viewport.setSize(w, h);
+	if(dispatcher)
+		dispatcher->reindex(this);
 }//====================================================
 
 /**
@@ -238,10 +455,31 @@ void InteractiveObj::setSize(ofVec2f size){
 	setSize(size.x, size.y);
 }//====================================================
 
-void InteractiveObj::setX(float x){ viewport.x = x; }
-void InteractiveObj::setY(float y){ viewport.y = y; }
-void InteractiveObj::setWidth(float w){ viewport.width = w; }
-void InteractiveObj::setHeight(float h){ viewport.height = h; }
+/**
+ *  @brief Tell the object whether to record statistics
+ *  @details Statistics are recorded by default. When disabled, or when
+ *  compiled out with OFXPLOT_STATS=0, recording costs at most a branch.
+ *  @param enabled whether or not to record statistics
+ */
+void InteractiveObj::setStatsEnabled(bool enabled){ stats.setEnabled(enabled); }
+
+/**
+ *  @brief Tell the object whether to draw its statistics over its viewport
+ *  @details Showing the overlay enables the statistics
+ *  @param show whether or not to draw the overlay
+ */
+void InteractiveObj::setStatsOverlay(bool show){
+	if(show)
+		stats.setEnabled(true);
+
+	bStatsOverlay = show;
+	requestRedraw();
+}//====================================================
+
+void InteractiveObj::setX(float x){ setPosition(x, viewport.y); }
+void InteractiveObj::setY(float y){ setPosition(viewport.x, y); }
+void InteractiveObj::setWidth(float w){ setSize(w, viewport.height); }
+void InteractiveObj::setHeight(float h){ setSize(viewport.width, h); }
 
 //-----------------------------------------------------------------------------
 // -- Event Handlers --
@@ -332,17 +570,60 @@ void InteractiveObj::mouseMoved(ofMouseEventArgs &mouse){
 	mouseX = mouse.x;
 	mouseY = mouse.y;
 	
-	if(viewport.inside(mouse.x, mouse.y)){
-		isMouseInside = true;
-	}else{
-		isMouseInside = false;
-	}
+	bool inside = viewport.inside(mouse.x, mouse.y);
+	if(inside != isMouseInside)
+		requestRedraw();	// Edge is only drawn while hovered
+
+	isMouseInside = inside;
 }//====================================================
 
 //-----------------------------------------------------------------------------
 // -- Miscellaneous --
 //-----------------------------------------------------------------------------
 
+/**
+ *  @brief Add the background and border to a batch, as draw() would draw them
+ *  @details Derived classes call this at the start of addToBatch()
+ *  @param batch batch to add to
+ */
+void InteractiveObj::addFrameToBatch(ofxPlotBatch &batch){
+	bNeedsRedraw = false;
+
+	batch.addRect(viewport, bgColor);
+	if(isMouseInside)
+		batch.addRectOutline(viewport, edgeColor);
+}//====================================================
+
+/**
+ *  @brief Draw the statistics overlay, if it is enabled
+ *  @details Derived classes call this at the end of draw() so that the
+ *  overlay is drawn on top
+ */
+void InteractiveObj::drawStats(){
+	if(bStatsOverlay)
+		stats.draw(viewport);
+}//====================================================
+
+/**
+ *  @brief Determine whether a selection event carries a version this object
+ *  has not yet seen, and record it
+ *  @details Unversioned events, i.e., those not sent through
+ *  ofxPlotSelectionGroup::select() or deselect(), are always new
+ * 
+ *  @param args selection event arguments
+ *  @return whether or not the event should be applied
+ */
+bool InteractiveObj::isNewSelection(const DataSelectedEventArgs &args){
+	if(args.version == 0)
+		return true;
+
+	if(args.version <= selectionVersion)
+		return false;
+
+	selectionVersion = args.version;
+	return true;
+}//====================================================
+
 /**
  *  @brief Give the camera the event object
  *  @param evts reference to the window's events object
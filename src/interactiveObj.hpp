@@ -27,10 +27,20 @@
 
 #pragma once
 
+#include "ofxPlotFont.hpp"
+#include "ofxPlotMemory.hpp"
+#include "ofxPlotStats.hpp"
+
 #include "ofMain.h"
 
+#include <cstdint>
+#include <memory>
+
 // Forward Declarations
 class DataSelectedEventArgs;
+class ofxPlotBatch;
+class ofxPlotDispatcher;
+class ofxPlotSelectionGroup;
 
 class InteractiveObj{
 public:
@@ -39,7 +49,12 @@ public:
 	
 	virtual void setup();
 	virtual void update();
+	virtual void prepare();
 	virtual void draw();
+	void drawCached();
+
+	virtual bool addToBatch(ofxPlotBatch&);
+	virtual void drawUnbatched();
 	
 	void enableKeyInput();
 	void enableMouseInput();
@@ -47,19 +62,30 @@ public:
 	void disableMouseInput();
 
 
+	virtual ofxPlotMemory getMemoryUsage() const;
 	ofVec2f getPosition() const;
 	ofVec2f getSize() const;
+	std::shared_ptr<ofxPlotSelectionGroup> getSelectionGroup() const;
+	const ofxPlotStats& getStats() const;
 	ofRectangle getViewport() const;
 
 	bool isHovered() const;
+	virtual bool needsRedraw() const;
+	void requestRedraw();
 
 	virtual void setBGColor(ofColor);
+	virtual void setDispatcher(ofxPlotDispatcher*);
 	virtual void setEdgeColor(ofColor);
 	virtual void setFont(ofTrueTypeFont);
+	virtual void setFont(std::shared_ptr<ofxPlotFont>);
+	void setSelectionGroup(std::shared_ptr<ofxPlotSelectionGroup>);
+	void setSelectionGroup(std::string);
 	virtual void setPosition(float, float);
 	void setPosition(ofVec2f);
 	virtual void setSize(float, float);
 	void setSize(ofVec2f);
+	void setStatsEnabled(bool);
+	void setStatsOverlay(bool);
 	virtual void setX(float);
 	virtual void setY(float);
 	virtual void setWidth(float);
@@ -79,6 +105,7 @@ public:
 protected:
 
 	bool areEventsSet = false;			//!< Whether or not the events have been set
+	bool bNeedsRedraw = true;			//!< Whether or not the appearance has changed since the last draw
 	bool isMouseInside = false;			//!< Whether or not the mouse is inside the bounds defined by the viewport rectangle
 	bool isMouseInputEnabled = false;	//!< Whether or not the user can interact with the plot using the mouse
 	bool isMousePressedInside = false;	//!< Whether or not the mouse was pressed while inside the object
@@ -91,12 +118,22 @@ protected:
 	ofVec2f mousePressedPt;				//!< Last point where the mouse was pressed, screen coordinates
 
 	ofCoreEvents *events;				//!< Pointer to events object
+	ofxPlotDispatcher *dispatcher = nullptr;	//!< Routes pointer events to this object; nullptr to listen to events directly
+	std::shared_ptr<ofxPlotSelectionGroup> selectionGroup;	//!< Group that this object sends and receives selections within
+	uint64_t selectionVersion = 0;		//!< Most recent selection version received from the group
 
 	ofColor bgColor = ofColor(50, 50, 50, 0.85*255);		//!< Background color
 	ofColor edgeColor = ofColor(200, 200, 200, 0.95*255);	//!< Edge color
 
 	ofRectangle viewport = ofRectangle(0, 0, 350, 350);		//!< Describes the area the object occupies in screen space
-	ofTrueTypeFont font;									//!< Font used to render text
+	std::shared_ptr<ofxPlotFont> font;						//!< Font used to render text; may be shared with other objects
+	ofFbo cacheFbo;											//!< Stores the most recent rendering for drawCached()
+
+	ofxPlotStats stats;				//!< Counters and timers describing the work done each frame
+	bool bStatsOverlay = false;		//!< Whether or not the statistics are drawn over the object
 
+	void addFrameToBatch(ofxPlotBatch&);
+	void drawStats();
+	bool isNewSelection(const DataSelectedEventArgs&);
 	void setEvents(ofCoreEvents&);
 };
\ No newline at end of file
@@ -27,8 +27,17 @@
 #include "ofxPlot.hpp"
 
 #include "dataSelectedEvent.hpp"
+#include "ofxPlotBatch.hpp"
+#include "ofxPlotSVG.hpp"
+#include "ofxPlotSelectionGroup.hpp"
+#include "ofxPlotShaders.hpp"
+#include "ofxPlotSharedRing.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <exception>
 
 //-----------------------------------------------------------------------------
 // -- *structors --
@@ -36,6 +45,7 @@
 
 /**
  *  @brief Construct a default ofxPlot object
+ *  @details The plot is created with a single, empty data series
  */
 ofxPlot::ofxPlot() : InteractiveObj(){
 	indAxis.setColor(axesColor);
@@ -43,240 +53,2466 @@ ofxPlot::ofxPlot() : InteractiveObj(){
 
 	indAxis.setLineWidth(axesWidth);
 	depAxis.setLineWidth(axesWidth);
+
+	series.push_back(ofxPlotSeries());
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Graphics --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Update the plot
+ *  @details Samples published to attached shared rings since the last update
+ *  are added to their series. If input coalescing is enabled, the most
+ *  recent mouse move and drag are processed here.
+ *  @see attachSharedRing()
+ *  @see setCoalesceInput()
+ */
+void ofxPlot::update(){
+	readSharedRings();
+
+	if(memoryCap > 0)
+		applyMemoryCap();
+
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
+	InteractiveObj::update();
+	flushPendingInput();
+}//====================================================
+
+/**
+ *  @brief Prepare the plot to be drawn
+ *  @details Computes the transform and performs the CPU-side work for the
+ *  current plot style: transforming the data and building paths for the CPU
+ *  path, binning for the density style, swapping in and launching background
+ *  geometry builds, progressive refinement, the highlight geometry, and the
+ *  axes ticks and gridlines. Each step is skipped if its inputs have not
+ *  changed. No OpenGL calls are made, so this may run on a
+ *  worker thread.
+ *  @see InteractiveObj::prepare()
+ */
+void ofxPlot::prepare(){
+	OFXPLOT_SET(stats, ofxPlotStats::PTS_STORED, getNumPoints());
+	updateTransform();
+
+	if(!bTicksValid || bTicksHaveData != hasData()){
+		OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+		buildTicks();
+	}
+
+	if(getIndexExtent() != highlightExtent)
+		updateVisibleHighlights();
+
+	if(!visibleHighlights.empty() && !bHighlightMeshValid){
+		OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+		buildHighlightMesh();
+	}
+	updateValueStr();
+
+	bool asyncLines = bAsyncGeometry && plotStyle == ofxPlotStyle::LINE;
+	bool progressive = scheduler && plotStyle == ofxPlotStyle::LINE && !bAsyncGeometry;
+	bRefinementPending = false;
+	if(asyncLines)
+		updateAsyncGeometry();
+	else if(progressive)
+		refineLines();
+
+	if(plotStyle == ofxPlotStyle::DENSITY){
+		if(!bDensityValid){
+			OFXPLOT_TIME(stats, ofxPlotStats::TRANSFORM);
+			std::vector<const std::vector<dataPt>*> data;
+			for(size_t s = 0; s < series.size(); s++){
+				data.push_back(&series[s].data);
+			}
+			densityGrid.reset(plotArea);
+			densityGrid.add(data, dataOrigin, xScale, yScale);
+			densityGrid.toPixels(densityPix);
+			bDensityTexStale = true;
+			bDensityValid = true;
+		}
+	}else if((plotStyle == ofxPlotStyle::LINE && !asyncLines && !progressive && !(bGPUTransform && !bShaderFailed)) ||
+		(plotStyle == ofxPlotStyle::SCATTER && bScatterShaderFailed)){
+
+		for(size_t s = 0; s < series.size(); s++){
+			if(!series[s].data.empty())
+				updateDisplayData(series[s]);
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Draw the plot
+ */
+void ofxPlot::draw(){
+	prepare();
+	InteractiveObj::draw();
+
+	ofDisableDepthTest();
+	ofPushStyle();
+
+	drawAxes(nullptr);
+	drawLabels(nullptr);
+
+	if(hasData()){
+		OFXPLOT_TIME(stats, ofxPlotStats::SUBMIT);
+		drawData();
+	}
+
+	drawHighlights(nullptr);
+
+	ofPopStyle();
+	ofEnableDepthTest();
+
+	drawStats();
+}//====================================================
+
+/**
+ *  @brief Add the axes, labels, highlights, and (when possible) the data
+ *  to a batch
+ *  @details Line plots whose series are not filled are added to the batch;
+ *  other styles, and labels that are drawn without a font, are left for
+ *  drawUnbatched()
+ * 
+ *  @param batch batch to add to
+ *  @return true; the plot always supports batching
+ */
+bool ofxPlot::addToBatch(ofxPlotBatch &batch){
+	prepare();
+	addFrameToBatch(batch);
+
+	drawAxes(&batch);
+	drawLabels(&batch);
+
+	bDataBatched = isDataBatchable();
+	if(bDataBatched && hasData()){
+		OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+		for(size_t s = 0; s < series.size(); s++){
+			const ofxPlotSeries &ser = series[s];
+			size_t n = 0;
+			if(bAsyncGeometry){
+				if(frontGeometry && s < frontGeometry->getNumSeries()){
+					batch.addLineStrip(frontGeometry->getLine(s), ser.lineColor, ser.lineWidth);
+					n = frontGeometry->getLine(s).size();
+				}
+			}else if(scheduler){
+				batch.addLineStrip(ser.refinementMesh.getVertices(), ser.lineColor, ser.lineWidth);
+				n = ser.refinementMesh.getNumVertices();
+			}else{
+				batch.addLineStrip(ser.displayData, ser.lineColor, ser.lineWidth);
+				n = ser.displayData.size();
+			}
+			OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, n);
+		}
+	}
+
+	drawHighlights(&batch);
+	return true;
+}//====================================================
+
+/**
+ *  @brief Draw the parts of the plot that addToBatch() could not batch
+ */
+void ofxPlot::drawUnbatched(){
+	ofDisableDepthTest();
+	ofPushStyle();
+
+	if(!(font && font->isLoaded()))
+		drawLabels(nullptr);
+
+	if(!bDataBatched && hasData()){
+		OFXPLOT_TIME(stats, ofxPlotStats::SUBMIT);
+		drawData();
+	}
+
+	ofPopStyle();
+	ofEnableDepthTest();
+
+	drawStats();
+}//====================================================
+
+/**
+ *  @brief Draw or batch the gridlines, the tick marks, and the axes arrows
+ *  @details The gridlines and tick marks are cached meshes (see buildTicks())
+ *  @param batch batch to add the lines to; nullptr to draw them immediately
+ */
+void ofxPlot::drawAxes(ofxPlotBatch *batch){
+	float plot_x = plotArea.x;
+	float plot_y = plotArea.y + plotArea.height;	// Bottom-left corner of the area within the axes
+
+	ofVec2f indStart(plot_x, dataOrigin.y), indEnd(plot_x + plotArea.width, dataOrigin.y);
+	ofVec2f depStart(dataOrigin.x, plot_y), depEnd(dataOrigin.x, plot_y - plotArea.height);
+	if(batch){
+		if(bGridLines)
+			batch->addLines(gridMesh.getVertices(), gridColor);
+		batch->addLines(tickMesh.getVertices(), axesColor);
+		indAxis.addToBatch(*batch, indStart, indEnd, 10);
+		depAxis.addToBatch(*batch, depStart, depEnd, 10);
+	}else{
+		ofSetLineWidth(1);
+		if(bGridLines && gridMesh.getNumVertices() > 0){
+			ofSetColor(gridColor);
+			gridMesh.draw();
+		}
+		if(tickMesh.getNumVertices() > 0){
+			ofSetColor(axesColor);
+			tickMesh.draw();
+		}
+
+		indAxis.draw(indStart, indEnd, 10);
+		depAxis.draw(depStart, depEnd, 10);
+	}
+}//====================================================
+
+/**
+ *  @brief Draw the data in the current plot style
+ */
+void ofxPlot::drawData(){
+	if(plotStyle == ofxPlotStyle::DENSITY)
+		drawDataDensity();
+	else if(plotStyle == ofxPlotStyle::SCATTER)
+		drawDataScatter();
+	else if(bAsyncGeometry)
+		drawDataAsync();
+	else if(scheduler)
+		drawDataProgressive();
+	else if(bGPUTransform && !bShaderFailed)
+		drawDataGPU();
+	else
+		drawDataCPU();
+}//====================================================
+
+/**
+ *  @brief Draw or batch the highlight rings, the cross hairs, and the
+ *  selection rectangle
+ *  @param batch batch to add the shapes to; nullptr to draw them immediately
+ */
+void ofxPlot::drawHighlights(ofxPlotBatch *batch){
+	float plot_w = plotArea.width;
+	float plot_h = plotArea.height;
+	float plot_x = plotArea.x;
+	float plot_y = plotArea.y + plotArea.height;
+
+	if(!visibleHighlights.empty()){
+		if(batch){
+			batch->addLines(highlightMesh.getVertices(), ofColor::yellow, 2);
+		}else{
+			ofSetColor(ofColor::yellow);
+			ofSetLineWidth(2);
+			highlightMesh.draw();
+			ofSetLineWidth(1);
+		}
+
+		const dataPt *value = getCrossHairPt();
+		if(value){
+	        // Draw big cross hairs on the last (highest index) selected point
+	        ofVec2f pt = dataToScreen(*value);
+	        ofVec2f horizA(plot_x, pt.y), horizB(plot_x + plot_w, pt.y);
+	        ofVec2f vertA(pt.x, plot_y), vertB(pt.x, plot_y - plot_h);
+	        if(batch){
+	        	batch->addLine(horizA, horizB, axesColor);
+	        	batch->addLine(vertA, vertB, axesColor);
+	        }else{
+				ofSetColor(axesColor);
+				ofSetLineWidth(1);
+		        ofDrawLine(horizA, horizB);
+		        ofDrawLine(vertA, vertB);
+		    }
+	    }
+	}
+
+	if(!selectedArea.isZero()){
+		if(batch){
+			batch->addRectOutline(selectedArea, axesColor);
+		}else{
+			ofSetColor(axesColor);
+			ofNoFill();
+			ofSetLineWidth(1);
+			ofDrawRectangle(selectedArea);
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Draw or batch the title, the axes labels, the tick labels, and the
+ *  value of the cross hairs point
+ *  @details Text is only batched when a font is loaded; otherwise, nothing
+ *  is added and the text must be drawn immediately later on. The tick labels
+ *  are only laid out again when the ticks or the font change.
+ * 
+ *  @param batch batch to add the text to; nullptr to draw it immediately
+ */
+void ofxPlot::drawLabels(ofxPlotBatch *batch){
+	bool hasFont = font && font->isLoaded();
+	if(batch && !hasFont)
+		return;
+
+	std::function<ofRectangle(const std::string&)> measure;
+	if(hasFont)
+		measure = [this](const std::string &str){ return font->getStringBoundingBox(str, 0,0); };
+
+	Labels lbl;
+	getLabels(lbl, measure);
+
+	const ofxPlotFont *labelFont = hasFont ? font.get() : nullptr;
+	if(!bTickLabelPtsValid || tickLabelFont != labelFont){
+		getTickLabelPts(tickLabelPts, measure);
+		tickLabelFont = labelFont;
+		bTickLabelPtsValid = true;
+	}
+
+	if(batch){
+		batch->addText(font, title, lbl.title.x, lbl.title.y, textColor);
+		batch->addText(font, xlabel, lbl.xlabel.x, lbl.xlabel.y, textColor);
+		batch->addText(font, ylabel, lbl.ylabel.x, lbl.ylabel.y, textColor, true);
+		for(size_t i = 0; i < xTicks.size() + yTicks.size(); i++){
+			const std::string &str = i < xTicks.size() ? xTicks[i].label : yTicks[i - xTicks.size()].label;
+			batch->addText(font, str, tickLabelPts[i].x, tickLabelPts[i].y, axesColor);
+		}
+		if(!valueStr.empty())
+			batch->addText(font, valueStr, lbl.value.x, lbl.value.y, axesColor);
+		return;
+	}
+
+	ofSetColor(textColor);
+	if(hasFont){
+		font->drawString(title, lbl.title.x, lbl.title.y);
+		font->drawString(xlabel, lbl.xlabel.x, lbl.xlabel.y);
+	}else{
+		ofDrawBitmapString(title, lbl.title.x, lbl.title.y);
+		ofDrawBitmapString(xlabel, lbl.xlabel.x, lbl.xlabel.y);
+	}
+
+	ofSetColor(axesColor);
+	for(size_t i = 0; i < xTicks.size() + yTicks.size(); i++){
+		const std::string &str = i < xTicks.size() ? xTicks[i].label : yTicks[i - xTicks.size()].label;
+		if(hasFont)
+			font->drawString(str, tickLabelPts[i].x, tickLabelPts[i].y);
+		else
+			ofDrawBitmapString(str, tickLabelPts[i].x, tickLabelPts[i].y);
+	}
+
+	ofSetColor(textColor);
+
+	ofPushMatrix();
+	ofRotate(-90, 0, 0, 1);						// Rotate camera for vertical axis
+	if(hasFont){
+		font->drawString(ylabel, lbl.ylabel.x, lbl.ylabel.y);
+	}else{
+		ofSetDrawBitmapMode(OF_BITMAPMODE_MODEL);	// This allows the bitmapString to rotate
+		ofDrawBitmapString(ylabel, lbl.ylabel.x, lbl.ylabel.y);
+	}
+	ofPopMatrix();
+
+	if(!valueStr.empty()){
+		ofSetColor(axesColor);
+		if(hasFont)
+			font->drawString(valueStr, lbl.value.x, lbl.value.y);
+		else
+			ofDrawBitmapString(valueStr, lbl.value.x, lbl.value.y);
+	}
+}//====================================================
+
+/**
+ *  @brief Choose the ticks on both axes and build the tick marks and
+ *  gridlines
+ *  @details Ticks fall on multiples of a "nice" step (see getNiceStep()),
+ *  spaced at least tickSpacing pixels apart; no tick is placed at zero,
+ *  where the axes cross, or under an arrowhead. The labels are formatted
+ *  here, with as many decimals as the step needs, so that they are only
+ *  formatted when the extents or the viewport change. The ticks, and their
+ *  labels, go on the side of each axis with more room.
+ */
+void ofxPlot::buildTicks(){
+	const float arrowSize = 10;		// As drawn by drawAxes()
+
+	xTicks.clear();
+	yTicks.clear();
+	gridMesh.clear();
+	gridMesh.setMode(OF_PRIMITIVE_LINES);
+	tickMesh.clear();
+	tickMesh.setMode(OF_PRIMITIVE_LINES);
+	bTicksValid = true;
+	bTicksHaveData = hasData();
+	bTickLabelPtsValid = false;
+
+	if(!bTicksHaveData || plotArea.width <= 0 || plotArea.height <= 0)
+		return;
+
+	tickDir.set(plotArea.getRight() - dataOrigin.x >= dataOrigin.x - plotArea.x ? 1 : -1,
+		dataOrigin.y - plotArea.y >= plotArea.getBottom() - dataOrigin.y ? -1 : 1);
+
+	for(int axis = 0; axis < 2; axis++){
+		bool horiz = axis == 0;
+
+		// Data range covered by the plot area
+		double lo = horiz ? (plotArea.x - dataOrigin.x)/xScale : (dataOrigin.y - plotArea.getBottom())/yScale;
+		double hi = horiz ? (plotArea.getRight() - dataOrigin.x)/xScale : (dataOrigin.y - plotArea.y)/yScale;
+		double step = getNiceStep(hi - lo, (horiz ? plotArea.width : plotArea.height)/tickSpacing);
+		if(step <= 0)
+			continue;
+
+		int decimals = step >= 1 ? 0 : (int)std::ceil(-std::log10(step) - 1e-9);
+		std::vector<Tick> &ticks = horiz ? xTicks : yTicks;
+		for(double k = std::ceil(lo/step); k <= std::floor(hi/step); k++){
+			if(k == 0)
+				continue;
+
+			double value = k*step;
+			Tick t;
+			t.pos = horiz ? dataOrigin.x + value*xScale : dataOrigin.y - value*yScale;
+			if(horiz ? t.pos > plotArea.getRight() - arrowSize : t.pos < plotArea.y + arrowSize)
+				continue;
+
+			t.label = ofToString(value, decimals);
+			ticks.push_back(t);
+
+			if(horiz){
+				gridMesh.addVertex(ofVec3f(t.pos, plotArea.y, 0));
+				gridMesh.addVertex(ofVec3f(t.pos, plotArea.getBottom(), 0));
+				tickMesh.addVertex(ofVec3f(t.pos, dataOrigin.y, 0));
+				tickMesh.addVertex(ofVec3f(t.pos, dataOrigin.y + tickDir.y*tickLength, 0));
+			}else{
+				gridMesh.addVertex(ofVec3f(plotArea.x, t.pos, 0));
+				gridMesh.addVertex(ofVec3f(plotArea.getRight(), t.pos, 0));
+				tickMesh.addVertex(ofVec3f(dataOrigin.x, t.pos, 0));
+				tickMesh.addVertex(ofVec3f(dataOrigin.x + tickDir.x*tickLength, t.pos, 0));
+			}
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Build the rings drawn around the visible highlighted points
+ *  @details The rings for all series are stored in a single mesh, which is
+ *  only rebuilt when the visible highlights, the data, or the transform
+ *  change
+ */
+void ofxPlot::buildHighlightMesh(){
+	const int segs = 12;
+	const float radius = 4;
+	ofVec3f ring[segs + 1];
+	for(int k = 0; k <= segs; k++){
+		ring[k] = ofVec3f(radius*cos(TWO_PI*k/segs), radius*sin(TWO_PI*k/segs), 0);
+	}
+
+	highlightMesh.clear();
+	highlightMesh.setMode(OF_PRIMITIVE_LINES);
+
+	// Indices are shared by all series, e.g., samples at a common time
+	const std::vector<ofxPlotRangeSet::range_t> &ranges = visibleHighlights.getRanges();
+	for(size_t s = 0; s < series.size(); s++){
+		const std::vector<dataPt> &data = series[s].data;
+		for(size_t r = 0; r < ranges.size() && ranges[r].first < data.size(); r++){
+			for(size_t i = ranges[r].first; i < std::min(ranges[r].second, data.size()); i++){
+				ofVec3f center(dataToScreen(data[i]));
+				for(int k = 0; k < segs; k++){
+					highlightMesh.addVertex(center + ring[k]);
+					highlightMesh.addVertex(center + ring[k + 1]);
+				}
+			}
+		}
+	}
+
+	bHighlightMeshValid = true;
+}//====================================================
+
+/**
+ *  @brief Build the line (or fill) meshes for progressive refinement
+ *  @details Each series is drawn through its refined points, then through
+ *  a sample of about four points per pixel column from the points that have
+ *  not been refined yet. The meshes therefore always span all of the data,
+ *  and their size is bounded by the plot width rather than the data size.
+ */
+void ofxPlot::buildRefinementMeshes(){
+	OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+	std::vector<ofVec3f> line, pending;
+	size_t samples = std::max<size_t>(1, (size_t)(4*plotArea.width));
+	for(size_t s = 0; s < series.size(); s++){
+		ofxPlotSeries &ser = series[s];
+		const std::vector<dataPt> &data = ser.data;
+
+		line = ser.refinement.getLine();
+		ser.refinement.getPending(pending);
+		line.insert(line.end(), pending.begin(), pending.end());
+
+		size_t next = ser.refinement.getCount();
+		if(next < data.size()){
+			size_t step = std::max<size_t>(1, (data.size() - next)/samples);
+			for(size_t i = next; i < data.size(); i += step){
+				line.push_back(ofVec3f(dataToScreen(data[i])));
+			}
+			line.push_back(ofVec3f(dataToScreen(data.back())));
+		}
+
+		ser.refinementMesh.clear();
+		if(ser.fillPlot){
+			// Fill between the line and the horizontal axis (dependent variable = 0)
+			ser.refinementMesh.setMode(OF_PRIMITIVE_TRIANGLE_STRIP);
+			for(size_t i = 0; i < line.size(); i++){
+				ser.refinementMesh.addVertex(line[i]);
+				ser.refinementMesh.addVertex(ofVec3f(line[i].x, dataOrigin.y, 0));
+			}
+		}else{
+			ser.refinementMesh.setMode(OF_PRIMITIVE_LINE_STRIP);
+			ser.refinementMesh.addVertices(line);
+		}
+	}
+
+	refinementMeshVersion = dataVersion;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Draw series from the shared VBOs with as few draw calls as possible
+ *  @details Series are drawn in windows of ofxPlotShaders::maxBatchSeries so
+ *  that their styles fit in the shader's uniform arrays. Within a window, all
+ *  series that share a line width are drawn with a single glMultiDrawArrays
+ *  call. The shader must be bound, with its transform uniforms set.
+ * 
+ *  @param vbo VBO to draw from; each series occupies its own block
+ *  @param mode OpenGL primitive mode
+ *  @param vertsPerPt number of vertices stored per data point
+ *  @param shader active shader; receives the per-series uniforms
+ *  @param filled for line and triangle modes, whether to draw the filled
+ *  series (true) or the stroked series (false); all series are drawn in
+ *  GL_POINTS mode
+ */
+void ofxPlot::drawBatched(ofVbo &vbo, int mode, int vertsPerPt, const ofShader &shader, bool filled){
+	const size_t batch = ofxPlotShaders::maxBatchSeries;
+	std::vector<float> colors(4*batch, 0), sizes(batch, 0);
+	std::vector<size_t> ixs;
+	std::vector<GLint> firsts;
+	std::vector<GLsizei> counts;
+
+	for(size_t base = 0; base < series.size(); base += batch){
+		size_t end = std::min(series.size(), base + batch);
+
+		ixs.clear();
+		for(size_t s = base; s < end; s++){
+			ofFloatColor c = series[s].lineColor;
+			colors[4*(s - base)] = c.r;
+			colors[4*(s - base) + 1] = c.g;
+			colors[4*(s - base) + 2] = c.b;
+			colors[4*(s - base) + 3] = c.a;
+			sizes[s - base] = series[s].markerSize;
+
+			if(series[s].vboCount > 1 || (mode == GL_POINTS && series[s].vboCount > 0)){
+				if(mode == GL_POINTS || series[s].fillPlot == filled)
+					ixs.push_back(s);
+			}
+		}
+
+		if(ixs.empty())
+			continue;
+
+		shader.setUniform4fv("seriesColors", &colors[0], batch);
+		if(mode == GL_POINTS)
+			shader.setUniform1fv("seriesSizes", &sizes[0], batch);
+		shader.setUniform1i("seriesBase", base);
+
+		// Group series that share a line width
+		std::stable_sort(ixs.begin(), ixs.end(), [this](size_t a, size_t b){
+			return series[a].lineWidth < series[b].lineWidth;
+		});
+
+		vbo.bind();
+		for(size_t i = 0; i < ixs.size(); ){
+			float width = series[ixs[i]].lineWidth;
+			firsts.clear();
+			counts.clear();
+			for( ; i < ixs.size() && (mode == GL_POINTS || series[ixs[i]].lineWidth == width); i++){
+				firsts.push_back(vertsPerPt*series[ixs[i]].vboFirst);
+				counts.push_back(vertsPerPt*series[ixs[i]].vboCount);
+			}
+
+			if(mode == GL_LINE_STRIP)
+				ofSetLineWidth(width);
+
+			glMultiDrawArrays(mode, &firsts[0], &counts[0], firsts.size());
+		}
+		vbo.unbind();
+	}
+}//====================================================
+
+/**
+ *  @brief Draw the most recently completed background geometry
+ *  @details Nothing is drawn until the first build completes. The meshes are
+ *  only rebuilt when new geometry is swapped in, and hold at most four
+ *  vertices per pixel column for each series, regardless of the number of
+ *  points.
+ *  @see updateAsyncGeometry()
+ */
+void ofxPlot::drawDataAsync(){
+	if(!frontGeometry)
+		return;
+
+	if(bAsyncMeshStale){
+		OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+		size_t n = frontGeometry->getNumSeries();
+		asyncLineMeshes.resize(n);
+		asyncFillMeshes.resize(n);
+		for(size_t s = 0; s < n; s++){
+			asyncLineMeshes[s].clear();
+			asyncLineMeshes[s].setMode(OF_PRIMITIVE_LINE_STRIP);
+			asyncLineMeshes[s].addVertices(frontGeometry->getLine(s));
+
+			asyncFillMeshes[s].clear();
+			asyncFillMeshes[s].setMode(OF_PRIMITIVE_TRIANGLE_STRIP);
+			asyncFillMeshes[s].addVertices(frontGeometry->getFill(s));
+		}
+		bAsyncMeshStale = false;
+	}
+
+	for(size_t s = 0; s < std::min(series.size(), asyncLineMeshes.size()); s++){
+		ofSetColor(series[s].lineColor);
+		if(asyncFillMeshes[s].getNumVertices() > 0){
+			asyncFillMeshes[s].draw();
+		}else{
+			ofSetLineWidth(series[s].lineWidth);
+			asyncLineMeshes[s].draw();
+		}
+		OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, asyncLineMeshes[s].getNumVertices());
+	}
+}//====================================================
+
+/**
+ *  @brief Draw the data by transforming each point into screen
+ *  coordinates on the CPU
+ *  @details The screen coordinates and the path through them are
+ *  cached and only recomputed when the transform or the data change
+ */
+void ofxPlot::drawDataCPU(){
+	for(size_t s = 0; s < series.size(); s++){
+		if(series[s].data.empty())
+			continue;
+
+		updateDisplayData(series[s]);
+
+		series[s].dataPath.setColor(series[s].lineColor);
+		series[s].dataPath.draw();
+		OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, series[s].displayData.size());
+	}
+}//====================================================
+
+/**
+ *  @brief Draw the data as a color-mapped density image
+ *  @details Each pixel of the plot area is colored by the number of points,
+ *  from all series, that fall within it. The image is built by prepare() and
+ *  only re-uploaded after the data or the transform change.
+ */
+void ofxPlot::drawDataDensity(){
+	if(bDensityTexStale){
+		if(!densityTex.isAllocated() || densityTex.getWidth() != densityPix.getWidth() ||
+			densityTex.getHeight() != densityPix.getHeight()){
+
+			densityTex.allocate(densityPix);
+			densityTex.setTextureMinMagFilter(GL_NEAREST, GL_NEAREST);
+			OFXPLOT_COUNT(stats, ofxPlotStats::ALLOCATIONS, 1);
+		}else{
+			densityTex.loadData(densityPix);
+		}
+		bDensityTexStale = false;
+	}
+
+	ofSetColor(255);
+	densityTex.draw(plotArea.x, plotArea.y, densityGrid.getWidth(), densityGrid.getHeight());
+}//====================================================
+
+/**
+ *  @brief Draw the data by applying the data transform in a vertex shader
+ *  @details The offset-relative data for all series are uploaded to shared
+ *  buffers once; new points are appended to the existing buffers. Changes to
+ *  the viewport or the data extents only update the shader uniforms. If the
+ *  shader cannot be loaded, the plot falls back to the CPU transform.
+ */
+void ofxPlot::drawDataGPU(){
+	if(!transformShader.isLoaded()){
+		if(!ofxPlotShaders::setupTransform(transformShader)){
+			ofLogWarning("ofxPlot") << "Could not load the data transform shader; using the CPU transform instead";
+			bShaderFailed = true;
+			drawDataCPU();
+			return;
+		}
+	}
+
+	uploadData();
+	if(vboCapacity == 0)
+		return;
+
+	// The VBO stores raw = data - vboOffset, so screen = dataOrigin + scale*(raw + vboOffset)
+	float origin_x = dataOrigin.x + xScale*vboOffset.indVar;
+	float origin_y = dataOrigin.y - yScale*vboOffset.depVar;
+
+	OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, getNumPoints());
+
+	transformShader.begin();
+	transformShader.setUniform2f("origin", origin_x, origin_y);
+	transformShader.setUniform2f("scale", xScale, -yScale);
+	drawBatched(fillVbo, GL_TRIANGLE_STRIP, 2, transformShader, true);
+	drawBatched(dataVbo, GL_LINE_STRIP, 1, transformShader, false);
+	transformShader.end();
+}//====================================================
+
+/**
+ *  @brief Draw the progressively refined lines
+ *  @details The meshes are built by prepare()
+ *  @see refineLines()
+ */
+void ofxPlot::drawDataProgressive(){
+	for(size_t s = 0; s < series.size(); s++){
+		if(series[s].refinementMesh.getNumVertices() == 0)
+			continue;
+
+		ofSetColor(series[s].lineColor);
+		if(!series[s].fillPlot)
+			ofSetLineWidth(series[s].lineWidth);
+
+		series[s].refinementMesh.draw();
+		OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, series[s].refinementMesh.getNumVertices());
+	}
+}//====================================================
+
+/**
+ *  @brief Draw the data as unconnected markers
+ *  @details Markers are rendered as point sprites straight from the
+ *  retained vertex buffer, with optional per-point size and color
+ *  attributes, so the cost of a frame is a single draw call for up to
+ *  ofxPlotShaders::maxBatchSeries series, regardless of the number of
+ *  points. If the scatter shader cannot be loaded, each marker is drawn
+ *  individually instead.
+ */
+void ofxPlot::drawDataScatter(){
+	if(!scatterShader.isLoaded() && !bScatterShaderFailed){
+		if(!ofxPlotShaders::setupScatter(scatterShader)){
+			ofLogWarning("ofxPlot") << "Could not load the scatter shader; drawing markers individually instead";
+			bScatterShaderFailed = true;
+		}
+	}
+
+	if(bScatterShaderFailed){
+		ofFill();
+		for(size_t s = 0; s < series.size(); s++){
+			ofxPlotSeries &ser = series[s];
+			updateDisplayData(ser);
+			for(size_t i = 0; i < ser.displayData.size(); i++){
+				bool hasColor = i < ser.ptColors.size() && ser.ptColors[i].a >= 0;
+				bool hasSize = i < ser.ptSizes.size() && ser.ptSizes[i] > 0;
+				ofSetColor(hasColor ? ofColor(ser.ptColors[i]) : ser.lineColor);
+				ofDrawCircle(ser.displayData[i], 0.5*(hasSize ? ser.ptSizes[i] : ser.markerSize));
+			}
+			OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, ser.displayData.size());
+		}
+		return;
+	}
+
+	uploadData();
+	if(vboCapacity == 0)
+		return;
+
+	uploadPointAttributes();
+
+	bool useSizes = false, useColors = false;
+	for(size_t s = 0; s < series.size(); s++){
+		useSizes = useSizes || !series[s].ptSizes.empty();
+		useColors = useColors || !series[s].ptColors.empty();
+	}
+
+	// The VBO stores raw = data - vboOffset, so screen = dataOrigin + scale*(raw + vboOffset)
+	float origin_x = dataOrigin.x + xScale*vboOffset.indVar;
+	float origin_y = dataOrigin.y - yScale*vboOffset.depVar;
+
+	OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, getNumPoints());
+
+	scatterShader.begin();
+	scatterShader.setUniform2f("origin", origin_x, origin_y);
+	scatterShader.setUniform2f("scale", xScale, -yScale);
+	scatterShader.setUniform1i("useSizes", useSizes ? 1 : 0);
+	scatterShader.setUniform1i("useColors", useColors ? 1 : 0);
+
+	ofEnablePointSprites();
+	glEnable(GL_PROGRAM_POINT_SIZE);
+	drawBatched(dataVbo, GL_POINTS, 1, scatterShader, false);
+	glDisable(GL_PROGRAM_POINT_SIZE);
+	ofDisablePointSprites();
+
+	scatterShader.end();
+}//====================================================
+
+/**
+ *  @brief Transform a data point into screen coordinates
+ *  @details The transform is updated each time the plot is drawn
+ * 
+ *  @param pt data point
+ *  @return the location of the data point in screen coordinates (pixels)
+ */
+ofVec2f ofxPlot::dataToScreen(const dataPt &pt) const{
+	return ofVec2f(dataOrigin.x + xScale*pt.indVar, dataOrigin.y - yScale*pt.depVar);
+}//====================================================
+
+/**
+ *  @brief Flag all cached, transform-dependent geometry for recomputation
+ */
+void ofxPlot::invalidateGeometry(){
+	for(size_t s = 0; s < series.size(); s++){
+		series[s].bDisplayDataValid = false;
+	}
+	bDensityValid = false;
+	bHighlightMeshValid = false;
+	bRefinementStale = true;
+	bTicksValid = false;
+}//====================================================
+
+/**
+ *  @brief Discard data until the plot is within its memory cap
+ *  @details Memory that does not depend on the data (e.g., the cache FBO)
+ *  is excluded. The data-dependent memory is reduced to half of what the cap
+ *  allows, so that the data vectors can double in capacity once before the
+ *  cap is reached again, rather than discarding points on every append.
+ *  Each series is reduced by the same fraction. Since points are removed,
+ *  highlighted indices refer to different points afterward.
+ *  @see setMemoryCap()
+ */
+void ofxPlot::applyMemoryCap(){
+	size_t data = getDataMemoryUsage();
+	if(data == 0)
+		return;
+
+	size_t fixed = InteractiveObj::getMemoryUsage().getTotal();	// At most a couple of entries
+	size_t total = fixed + data;
+	if(total <= memoryCap)
+		return;
+
+	if(memoryCap <= fixed){
+		ofLogWarning("ofxPlot") << "Memory cap of " << memoryCap << " bytes is smaller than the "
+			<< fixed << " bytes the plot needs without any data; disabling the cap";
+		memoryCap = 0;
+		return;
+	}
+
+	double keep = 0.5*(memoryCap - fixed)/(total - fixed);
+	size_t before = getNumPoints();
+
+	std::vector<size_t> ixs;
+	for(size_t s = 0; s < series.size(); s++){
+		const std::vector<dataPt> &data = series[s].data;
+		size_t n = data.size();
+		size_t target = std::max<size_t>(2, keep*n);
+		if(n <= target)
+			continue;
+
+		ixs.clear();
+		if(memoryPolicy == ofxPlotMemoryPolicy::EVICT_OLDEST){
+			for(size_t i = n - target; i < n; i++){
+				ixs.push_back(i);
+			}
+		}else{
+			// Keep the first and last points, and the extremes of each bucket, in order
+			size_t bucket = std::max<size_t>(2, (2*n + target - 1)/target);
+			ixs.push_back(0);
+			for(size_t first = 1; first < n - 1; first += bucket){
+				size_t last = std::min(first + bucket, n - 1);
+				size_t lo = first, hi = first;
+				for(size_t i = first + 1; i < last; i++){
+					if(data[i].depVar < data[lo].depVar)
+						lo = i;
+					if(data[i].depVar > data[hi].depVar)
+						hi = i;
+				}
+				ixs.push_back(std::min(lo, hi));
+				if(hi != lo)
+					ixs.push_back(std::max(lo, hi));
+			}
+			ixs.push_back(n - 1);
+		}
+
+		series[s].retain(ixs);
+		series[s].vboCapacity = 0;	// Lay out again, releasing the GPU memory, on the next upload
+	}
+
+	vboCapacity = 0;
+	dataVersion++;
+	capVersion = dataVersion;
+	invalidateGeometry();
+	requestRedraw();
+
+	ofLogVerbose("ofxPlot") << "Memory cap of " << memoryCap << " bytes exceeded (" << total
+		<< " bytes); reduced the data from " << before << " to " << getNumPoints() << " points";
+}//====================================================
+
+/**
+ *  @brief Locate the point that the cross hairs are drawn on
+ *  @details This is the last (highest index) visible highlight in the
+ *  highlighted series
+ *  @return pointer to the point, or nullptr if the series does not contain it
+ */
+const dataPt* ofxPlot::getCrossHairPt() const{
+	if(visibleHighlights.empty())
+		return nullptr;
+
+	const std::vector<dataPt> &data = series[std::min(highlightSeries, series.size() - 1)].data;
+	size_t ix = visibleHighlights.back();
+	return ix < data.size() ? &data[ix] : nullptr;
+}//====================================================
+
+/**
+ *  @brief Lay out the title, the axes labels, and the value of the cross
+ *  hairs point
+ *  @details Without a font, the text is placed for ofDrawBitmapString()
+ * 
+ *  @param lbl set to the text baseline locations
+ *  @param measure returns the bounding box of a string drawn at (0,0) with
+ *  the font the labels are drawn with; empty if there is no font
+ */
+void ofxPlot::getLabels(Labels &lbl, const std::function<ofRectangle(const std::string&)> &measure) const{
+	// Plot window properties
+	float win_y = viewport.getY();			// top-left corner, increases to the bottom
+	float win_h = viewport.getHeight();
+
+    // Characteristics of the area that information is plotted in
+    float plot_w = plotArea.width;				// Width of the area within the axes
+    float plot_h = plotArea.height;				// Height of the area within the axes
+    float plot_x = plotArea.x;					// Bottom-left corner of area within the axes
+    float plot_y = plotArea.y + plotArea.height;	// Bottom-left corner of the area within the axes
+
+	if(measure){
+		ofRectangle titleBox = measure(title);
+		lbl.title.set(plot_x + 0.5*(plot_w - titleBox.width), plot_y - plot_h - 5);
+		ofRectangle xLblBox = measure(xlabel);
+		lbl.xlabel.set(plot_x + 0.5*(plot_w - xLblBox.width), plot_y + padding - 5);
+		ofRectangle yLblBox = measure(ylabel);
+		lbl.ylabel.set(-plot_y - padding + 0.5*(plot_h - 2*yLblBox.height), plot_x - 5);
+
+		if(!valueStr.empty()){
+			ofRectangle dataBox = measure(valueStr);
+			lbl.value.set(plot_x + plot_w - padding - dataBox.width, plot_y + padding - 5);
+		}
+	}else{
+		lbl.title.set(plot_x + 0.5*plot_w, win_y + padding - 5);
+		lbl.xlabel.set(plot_x + 0.5*plot_w, win_y + win_h - 5);
+		lbl.ylabel.set(-plot_y - padding + 0.5*(plot_h - 2*padding), plot_x - 5);
+		lbl.value.set(plot_x + plot_w - 125 - padding, plot_y + padding - 5);
+	}
+}//====================================================
+
+/**
+ *  @brief Choose a tick step of 1, 2, or 5 times a power of ten
+ * 
+ *  @param range extent of the axis, data units
+ *  @param maxTicks most ticks the axis should have
+ *  @return the smallest such step that yields at most maxTicks ticks; zero
+ *  if the range is empty
+ */
+double ofxPlot::getNiceStep(double range, double maxTicks){
+	if(!(range > 0) || !std::isfinite(range))
+		return 0;
+
+	double rough = range/std::max(maxTicks, 1.0);
+	double mag = std::pow(10.0, std::floor(std::log10(rough)));
+	double f = rough/mag;
+	return (f <= 1 ? 1 : f <= 2 ? 2 : f <= 5 ? 5 : 10)*mag;
+}//====================================================
+
+/**
+ *  @brief Lay out the tick labels
+ *  @details Each label sits just past the end of its tick mark; labels on
+ *  the horizontal axis are centered on their ticks, and labels on the
+ *  vertical axis are centered vertically on theirs. Without a font, the
+ *  labels are placed for ofDrawBitmapString().
+ * 
+ *  @param pts set to the text baseline locations of the labels of xTicks,
+ *  then yTicks
+ *  @param measure returns the bounding box of a string drawn at (0,0) with
+ *  the font the labels are drawn with; empty if there is no font
+ */
+void ofxPlot::getTickLabelPts(std::vector<ofVec2f> &pts, const std::function<ofRectangle(const std::string&)> &measure) const{
+	const float gap = 3;		// Between the end of a tick mark and its label
+
+	pts.clear();
+	pts.reserve(xTicks.size() + yTicks.size());
+	for(size_t i = 0; i < xTicks.size() + yTicks.size(); i++){
+		bool horiz = i < xTicks.size();
+		const Tick &t = horiz ? xTicks[i] : yTicks[i - xTicks.size()];
+
+		// Bitmap characters are 8 pixels wide, and about 10 tall above the baseline
+		ofRectangle box = measure ? measure(t.label) : ofRectangle(0, -10, 8*t.label.size(), 10);
+		if(horiz){
+			float y = dataOrigin.y + tickDir.y*(tickLength + gap);
+			pts.push_back(ofVec2f(t.pos - 0.5*box.width, tickDir.y > 0 ? y + box.height : y));
+		}else{
+			float x = dataOrigin.x + tickDir.x*(tickLength + gap);
+			pts.push_back(ofVec2f(tickDir.x > 0 ? x : x - box.width, t.pos + 0.5*box.height));
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Determine the number of indices that exist in the data
+ *  @return the number of points in the longest series
+ */
+size_t ofxPlot::getIndexExtent() const{
+	size_t n = 0;
+	for(size_t s = 0; s < series.size(); s++){
+		n = std::max(n, series[s].data.size());
+	}
+	return n;
+}//====================================================
+
+/**
+ *  @brief Find the points of a series that may lie within a screen area,
+ *  using the spatial index of the background geometry
+ *  @details The area is converted to data coordinates with the current
+ *  transform, so the query remains valid after the transform changes. Points
+ *  added after the geometry's snapshot was taken are always included; points
+ *  modified since then are found at their previous locations until the next
+ *  geometry is swapped in.
+ * 
+ *  @param s index of the series
+ *  @param area area, screen coordinates
+ *  @param ixs indices of the candidate points, in ascending order; cleared first
+ *  @return whether or not an index was available; if not, ixs is empty
+ *  and every point must be tested
+ */
+bool ofxPlot::getIndexedCandidates(size_t s, const ofRectangle &area, std::vector<size_t> &ixs) const{
+	ixs.clear();
+	if(!bAsyncGeometry || plotStyle != ofxPlotStyle::LINE || !frontGeometry ||
+		frontGeometry->getNumSeries() != series.size() || frontGeometry->getDataVersion() < capVersion){
+
+		return false;
+	}
+
+	// The vertical axis points down in screen coordinates
+	dataPt lo((area.x - dataOrigin.x)/xScale, (dataOrigin.y - area.y - area.height)/yScale);
+	dataPt hi((area.x + area.width - dataOrigin.x)/xScale, (dataOrigin.y - area.y)/yScale);
+	frontGeometry->query(s, lo, hi, ixs);
+
+	size_t n = series[s].data.size();
+	while(!ixs.empty() && ixs.back() >= n){
+		ixs.pop_back();
+	}
+	for(size_t i = frontGeometry->getNumIndexed(s); i < n; i++){
+		ixs.push_back(i);
+	}
+	return true;
+}//====================================================
+
+/**
+ *  @brief Swap in completed background geometry, and start the next build
+ *  @details Only one build runs at a time, on its own thread so that it never
+ *  competes with the per-frame work on the shared thread pool. When a build
+ *  completes, its geometry replaces the geometry being drawn. If the data or
+ *  the transform have changed since that build started, the next build starts
+ *  right away from a fresh snapshot, so the drawn geometry is never more than
+ *  one generation behind. Snapshots are extended in place, so starting a build
+ *  costs time proportional to the points added or modified since the previous
+ *  build; the first build copies all of the data.
+ */
+void ofxPlot::updateAsyncGeometry(){
+	if(pendingGeometry.valid()){
+		if(pendingGeometry.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		try{
+			frontGeometry = pendingGeometry.get();
+		}catch(const std::exception &e){
+			ofLogWarning("ofxPlot") << "Could not build the line geometry in the background (" << e.what()
+				<< "); building it on the render thread instead";
+			setAsyncGeometry(false);
+			return;
+		}
+
+		bAsyncMeshStale = true;
+		requestRedraw();
+	}
+
+	if(frontGeometry && frontGeometry->getDataVersion() == dataVersion &&
+		frontGeometry->hasTransform(plotArea, xScale, yScale, dataOrigin)){
+
+		return;
+	}
+
+	std::shared_ptr<ofxPlotGeometry::Input> input = std::make_shared<ofxPlotGeometry::Input>();
+	for(size_t s = 0; s < series.size(); s++){
+		const std::vector<dataPt> *prev = series[s].snapshot.get();
+		input->data.push_back(series[s].updateSnapshot());
+		input->fill.push_back(series[s].fillPlot);
+
+		if(series[s].snapshot.get() != prev)
+			OFXPLOT_COUNT(stats, ofxPlotStats::ALLOCATIONS, 1);	// Full copy of the data
+	}
+	input->plotArea = plotArea;
+	input->xScale = xScale;
+	input->yScale = yScale;
+	input->dataOrigin = dataOrigin;
+	input->dataVersion = dataVersion;
+
+	// Release the snapshots before the result is published so that the next
+	// update can extend them in place rather than copying them
+	pendingGeometry = std::async(std::launch::async, [input]() mutable{
+		std::shared_ptr<const ofxPlotGeometry> geom = ofxPlotGeometry::build(*input);
+		input.reset();
+		return geom;
+	});
+}//====================================================
+
+/**
+ *  @brief Decimate more of the data, within the time granted by the scheduler
+ *  @details Refinement restarts whenever the transform changes, e.g., when the
+ *  data range or the viewport changes, and for any series whose refined points
+ *  are modified; appended points simply extend the work. Series are refined
+ *  in small chunks, in turn, and refinement stops as soon as the grant is
+ *  spent. The amount of time requested is estimated from the measured cost of
+ *  previous chunks. Until a series is fully refined, it is drawn through a
+ *  coarse sample of its remaining points.
+ */
+void ofxPlot::refineLines(){
+	bool rebuild = refinementMeshVersion != dataVersion;
+	if(bRefinementStale){
+		for(size_t s = 0; s < series.size(); s++){
+			series[s].refinement.reset(dataOrigin, xScale, yScale);
+		}
+		bRefinementStale = false;
+		rebuild = true;
+	}
+
+	size_t todo = 0;
+	for(size_t s = 0; s < series.size(); s++){
+		todo += series[s].data.size() - series[s].refinement.getCount();
+	}
+
+	size_t done = 0;
+	if(todo > 0){
+		OFXPLOT_TIME(stats, ofxPlotStats::TRANSFORM);
+		const size_t chunk = 4096;
+		uint64_t grant = scheduler->acquire((uint64_t)(todo*refineNsPerPt/1000) + 1);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		int64_t elapsed = 0;	// nanoseconds
+
+		for(bool more = grant > 0; more; ){
+			more = false;
+			for(size_t s = 0; s < series.size() && elapsed < 1000*(int64_t)grant; s++){
+				ofxPlotDecimator &ref = series[s].refinement;
+				size_t before = ref.getCount();
+				if(before >= series[s].data.size())
+					continue;
+
+				ref.add(series[s].data, before + chunk);
+				done += ref.getCount() - before;
+				more = more || ref.getCount() < series[s].data.size();
+
+				elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - start).count();
+			}
+			more = more && elapsed < 1000*(int64_t)grant;
+		}
+
+		if(grant > 0){
+			scheduler->release(grant - std::min<uint64_t>(grant, elapsed/1000));
+			if(done > 0)
+				refineNsPerPt = 0.5*refineNsPerPt + 0.5*elapsed/done;
+		}
+	}
+
+	bRefinementPending = done < todo;
+	if(done > 0 || rebuild)
+		buildRefinementMeshes();
+}//====================================================
+
+/**
+ *  @brief Update the screen coordinates of a series and the path through them
+ *  @details If the transform has not changed, only points added or modified
+ *  since the last update are transformed
+ * 
+ *  @param s series to update
+ */
+void ofxPlot::updateDisplayData(ofxPlotSeries &s){
+	size_t first = s.bDisplayDataValid ? s.displayData.size() : 0;
+	if(s.bDisplayDataValid && first == s.data.size() && s.dirtyPts.empty())
+		return;
+
+	// Refresh modified points, then transform any new points
+	{
+		OFXPLOT_TIME(stats, ofxPlotStats::TRANSFORM);
+		if(s.bDisplayDataValid){
+			const std::vector<ofxPlotRangeSet::range_t> &ranges = s.dirtyPts.getRanges();
+			for(size_t r = 0; r < ranges.size(); r++){
+				for(size_t i = ranges[r].first; i < std::min(ranges[r].second, first); i++){
+					s.displayData[i] = dataToScreen(s.data[i]);
+				}
+			}
+		}
+		s.dirtyPts.clear();
+
+		s.displayData.resize(s.data.size());
+		for(size_t i = first; i < s.data.size(); i++){
+			s.displayData[i] = dataToScreen(s.data[i]);
+		}
+	}
+
+	OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+	s.dataPath.clear();
+	for(size_t i = 0; i < s.displayData.size(); i++){
+		if(i == 0)
+			s.dataPath.moveTo(s.displayData[i]);
+		else
+			s.dataPath.lineTo(s.displayData[i]);
+	}
+	
+	s.dataPath.setFilled(s.fillPlot);
+    if(!s.fillPlot){
+		s.dataPath.setStrokeWidth(s.lineWidth);
+    }else if(!s.displayData.empty()){
+		// Fill between the line and the horizontal axis, like the GPU paths
+		s.dataPath.lineTo(s.displayData.back().x, dataOrigin.y);
+		s.dataPath.lineTo(s.displayData.front().x, dataOrigin.y);
+		s.dataPath.close();
+    }
+
+    s.bDisplayDataValid = true;
+}//====================================================
+
+/**
+ *  @brief Format the value of the cross hairs point
+ *  @details The string is only formatted again when the point changes,
+ *  rather than every frame
+ */
+void ofxPlot::updateValueStr(){
+	const dataPt *value = getCrossHairPt();
+	if(!value){
+		valueStr.clear();
+	}else if(valueStr.empty() || value->indVar != valueStrPt.indVar || value->depVar != valueStrPt.depVar){
+		char str[128];
+		snprintf(str, sizeof(str), "(%.4f, %.4f)", value->indVar, value->depVar);
+		valueStr = str;
+		valueStrPt = *value;
+	}
+}//====================================================
+
+/**
+ *  @brief Update the set of highlighted points that exist in the data
+ *  @details Only the highlighted ranges within the data are visited. If the
+ *  visible highlights change, the highlight mesh is rebuilt on the next draw.
+ */
+void ofxPlot::updateVisibleHighlights(){
+	highlightExtent = getIndexExtent();
+
+	ofxPlotRangeSet visible;
+	if(highlightPtIxs)
+		highlightPtIxs->slice(0, highlightExtent, visible);
+
+	if(visible != visibleHighlights){
+		visibleHighlights.swap(visible);
+		bHighlightMeshValid = false;
+		requestRedraw();
+	}
+}//====================================================
+
+/**
+ *  @brief Compute the plot area and the transformation from data
+ *  to screen coordinates
+ *  @details The data extents are maintained as points are added or modified,
+ *  so this function does not usually iterate through the data; the extents of
+ *  all series are combined so that every series shares the same axes. If the
+ *  transform changes, the cached screen coordinates are flagged for
+ *  recomputation.
+ */
+void ofxPlot::updateTransform(){
+	dataMin = dataPt();
+	dataMax = dataPt();
+	bool first = true;
+	for(size_t s = 0; s < series.size(); s++){
+		if(series[s].bExtentsStale){
+			OFXPLOT_TIME(stats, ofxPlotStats::EXTENTS);
+			series[s].updateExtents();
+		}
+
+		if(series[s].data.empty())
+			continue;
+
+		if(first){
+			dataMin = series[s].dataMin;
+			dataMax = series[s].dataMax;
+			first = false;
+		}else{
+			dataMin.indVar = std::min(dataMin.indVar, series[s].dataMin.indVar);
+			dataMin.depVar = std::min(dataMin.depVar, series[s].dataMin.depVar);
+			dataMax.indVar = std::max(dataMax.indVar, series[s].dataMax.indVar);
+			dataMax.depVar = std::max(dataMax.depVar, series[s].dataMax.depVar);
+		}
+	}
+
+	ofRectangle area(viewport.x + padding, viewport.y + padding,
+		viewport.width - 2*padding, viewport.height - 2*padding);
+
+	// Zero MUST be part of the data set
+	// ToDo (perhaps): allow axes to represent values other than x = 0 or y = 0
+	double maxX = std::max(dataMax.indVar, 0.0);
+	double minX = std::min(dataMin.indVar, 0.0);
+	double maxY = std::max(dataMax.depVar, 0.0);
+	double minY = std::min(dataMin.depVar, 0.0);
+
+	// Determine scaling amounts so that data will fit in plot area
+	double xs = maxX > minX ? area.width/(maxX - minX) : 1;
+	double ys = maxY > minY ? area.height/(maxY - minY) : 1;
+
+	// Place axes to use as much of the plot area as possible
+	ofVec2f origin(area.x - minX*xs, area.y + area.height + minY*ys);
+
+	if(area != plotArea || xs != xScale || ys != yScale || origin != dataOrigin)
+		invalidateGeometry();
+
+	plotArea = area;
+	xScale = xs;
+	yScale = ys;
+	dataOrigin = origin;
+}//====================================================
+
+/**
+ *  @brief Upload new and modified data to the GPU buffers
+ *  @details All series share one pair of buffers; each series owns a block
+ *  with room to grow geometrically, so appending points only uploads the new
+ *  points and modified points are uploaded as sub-buffer updates. When any
+ *  series outgrows its block, the blocks are laid out again and all data are
+ *  re-uploaded. Data are stored relative to vboOffset to preserve precision
+ *  when converting to single-precision floats.
+ */
+void ofxPlot::uploadData(){
+	bool relayout = false;
+	for(size_t s = 0; s < series.size(); s++){
+		relayout = relayout || series[s].data.size() > series[s].vboCapacity;
+	}
+
+	if(relayout){
+		vboCapacity = 0;
+		bool hasOffset = false;
+		for(size_t s = 0; s < series.size(); s++){
+			ofxPlotSeries &ser = series[s];
+			ser.vboFirst = vboCapacity;
+			ser.vboCapacity = ser.data.empty() ? 0 : std::max<size_t>(256, 2*ser.data.size());
+			ser.vboCount = 0;
+			ser.dirtyPts.clear();	// Everything is uploaded below
+			vboCapacity += ser.vboCapacity;
+
+			if(!hasOffset && !ser.data.empty()){
+				vboOffset = ser.data.front();
+				hasOffset = true;
+			}
+		}
+
+		if(vboCapacity == 0)
+			return;
+		
+		dataVbo.setVertexData((const float*)nullptr, 2, vboCapacity, GL_DYNAMIC_DRAW, sizeof(ofVec2f));
+		fillVbo.setVertexData((const float*)nullptr, 2, 2*vboCapacity, GL_DYNAMIC_DRAW, sizeof(ofVec2f));
+		OFXPLOT_COUNT(stats, ofxPlotStats::ALLOCATIONS, 2);
+
+		// The series that owns each vertex only changes with the layout
+		std::vector<float> owner(vboCapacity), fillOwner(2*vboCapacity);
+		for(size_t s = 0; s < series.size(); s++){
+			size_t first = series[s].vboFirst, last = first + series[s].vboCapacity;
+			std::fill(owner.begin() + first, owner.begin() + last, (float)s);
+			std::fill(fillOwner.begin() + 2*first, fillOwner.begin() + 2*last, (float)s);
+		}
+		dataVbo.setAttributeData(ofxPlotShaders::SERIES_ATTRIBUTE, &owner[0], 1, vboCapacity, GL_STATIC_DRAW);
+		fillVbo.setAttributeData(ofxPlotShaders::SERIES_ATTRIBUTE, &fillOwner[0], 1, 2*vboCapacity, GL_STATIC_DRAW);
+
+		bPtAttribsDirty = true;		// Attribute buffers must match the new layout
+	}
+
+	for(size_t s = 0; s < series.size(); s++){
+		ofxPlotSeries &ser = series[s];
+
+		const std::vector<ofxPlotRangeSet::range_t> &ranges = ser.dirtyPts.getRanges();
+		for(size_t r = 0; r < ranges.size(); r++){
+			uploadSpan(ser, ranges[r].first, std::min(ranges[r].second, ser.vboCount));
+		}
+		ser.dirtyPts.clear();
+
+		uploadSpan(ser, ser.vboCount, ser.data.size());
+		ser.vboCount = ser.data.size();
+	}
+}//====================================================
+
+/**
+ *  @brief Upload a contiguous span of a series to the GPU buffers
+ *  @details The series' block must already have capacity for the span
+ * 
+ *  @param s series that contains the span
+ *  @param first index of the first point in the span
+ *  @param last one past the index of the final point in the span
+ */
+void ofxPlot::uploadSpan(const ofxPlotSeries &s, size_t first, size_t last){
+	if(first >= last)
+		return;
+
+	size_t n = last - first;
+	std::vector<ofVec2f> raw(n), fill(2*n);
+	for(size_t i = 0; i < n; i++){
+		raw[i] = ofVec2f(s.data[first + i].indVar - vboOffset.indVar,
+			s.data[first + i].depVar - vboOffset.depVar);
+
+		// Fill between the data and the horizontal axis (dependent variable = 0)
+		fill[2*i] = raw[i];
+		fill[2*i + 1] = ofVec2f(raw[i].x, -vboOffset.depVar);
+	}
+
+	size_t offset = s.vboFirst + first;
+	dataVbo.getVertexBuffer().updateData(offset*sizeof(ofVec2f), n*sizeof(ofVec2f), &raw[0]);
+	fillVbo.getVertexBuffer().updateData(2*offset*sizeof(ofVec2f), 2*n*sizeof(ofVec2f), &fill[0]);
+}//====================================================
+
+/**
+ *  @brief Upload the per-point marker sizes and colors to the GPU
+ *  @details The attribute buffers span the full VBO capacity; points without
+ *  an explicit size or color are padded with values that select the series'
+ *  marker size and color in the shader
+ */
+void ofxPlot::uploadPointAttributes(){
+	if(!bPtAttribsDirty || vboCapacity == 0)
+		return;
+
+	bool anySizes = false, anyColors = false;
+	for(size_t s = 0; s < series.size(); s++){
+		anySizes = anySizes || !series[s].ptSizes.empty();
+		anyColors = anyColors || !series[s].ptColors.empty();
+	}
+
+	if(anySizes){
+		std::vector<float> sizes(vboCapacity, 0);
+		for(size_t s = 0; s < series.size(); s++){
+			const ofxPlotSeries &ser = series[s];
+			size_t n = std::min(ser.ptSizes.size(), ser.vboCapacity);
+			std::copy(ser.ptSizes.begin(), ser.ptSizes.begin() + n, sizes.begin() + ser.vboFirst);
+		}
+		dataVbo.setAttributeData(ofxPlotShaders::POINT_SIZE_ATTRIBUTE, &sizes[0], 1, vboCapacity, GL_DYNAMIC_DRAW);
+	}else{
+		dataVbo.clearAttribute(ofxPlotShaders::POINT_SIZE_ATTRIBUTE);
+	}
+
+	if(anyColors){
+		std::vector<float> rgba(4*vboCapacity, -1);
+		for(size_t s = 0; s < series.size(); s++){
+			const ofxPlotSeries &ser = series[s];
+			for(size_t i = 0; i < std::min(ser.ptColors.size(), ser.vboCapacity); i++){
+				size_t v = ser.vboFirst + i;
+				rgba[4*v] = ser.ptColors[i].r;
+				rgba[4*v + 1] = ser.ptColors[i].g;
+				rgba[4*v + 2] = ser.ptColors[i].b;
+				rgba[4*v + 3] = ser.ptColors[i].a;
+			}
+		}
+		dataVbo.setAttributeData(ofxPlotShaders::POINT_COLOR_ATTRIBUTE, &rgba[0], 4, vboCapacity, GL_DYNAMIC_DRAW);
+	}else{
+		dataVbo.clearAttribute(ofxPlotShaders::POINT_COLOR_ATTRIBUTE);
+	}
+
+	bPtAttribsDirty = false;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Export --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Describe the plot to a canvas, without OpenGL
+ *  @details The canvas receives the same content as draw(): the
+ *  background, the gridlines, the data in the current style, the axes and
+ *  their ticks, the labels, the highlights, and the selection, covering the viewport in screen
+ *  coordinates. Lines are decimated to at most four vertices per pixel
+ *  column (see ofxPlotDecimator), so the cost is bounded by the plot width
+ *  rather than the number of points; scatter markers are issued
+ *  individually. The labels are laid out with the canvas's font metrics.
+ * 
+ *  The plot is prepared first; no OpenGL calls are made, so different plots
+ *  may be drawn concurrently from different threads (one thread per plot).
+ * 
+ *  @param canvas canvas to draw to
+ *  @see writeSVG(), ofxPlotRaster
+ */
+void ofxPlot::drawTo(ofxPlotCanvas &canvas){
+	prepare();
+
+	canvas.begin(viewport.getStandardized());
+	canvas.fillRect(viewport, bgColor);
+
+	// Gridlines
+	const std::vector<ofVec3f> &grid = gridMesh.getVertices();
+	for(size_t i = 0; bGridLines && i + 1 < grid.size(); i += 2){
+		canvas.drawLine(grid[i], grid[i + 1], gridColor, 1);
+	}
+
+	// Data
+	if(plotStyle == ofxPlotStyle::DENSITY){
+		// One rectangle per run of equal pixels in each row
+		int w = densityPix.getWidth(), h = densityPix.getHeight();
+		for(int y = 0; y < h; y++){
+			int x0 = 0;
+			for(int x = 1; x <= w; x++){
+				if(x < w && densityPix.getColor(x, y) == densityPix.getColor(x0, y))
+					continue;
+
+				ofColor c = densityPix.getColor(x0, y);
+				if(c.a > 0)
+					canvas.fillRect(ofRectangle(plotArea.x + x0, plotArea.y + y, x - x0, 1), c);
+				x0 = x;
+			}
+		}
+	}else if(plotStyle == ofxPlotStyle::SCATTER){
+		for(size_t s = 0; s < series.size(); s++){
+			const ofxPlotSeries &ser = series[s];
+			for(size_t i = 0; i < ser.data.size(); i++){
+				bool hasColor = i < ser.ptColors.size() && ser.ptColors[i].a >= 0;
+				bool hasSize = i < ser.ptSizes.size() && ser.ptSizes[i] > 0;
+				canvas.fillCircle(dataToScreen(ser.data[i]), 0.5*(hasSize ? ser.ptSizes[i] : ser.markerSize),
+					hasColor ? ofColor(ser.ptColors[i]) : ser.lineColor);
+			}
+		}
+	}else{
+		ofxPlotDecimator decimator;
+		std::vector<ofVec3f> fill;
+		for(size_t s = 0; s < series.size(); s++){
+			const ofxPlotSeries &ser = series[s];
+			if(ser.data.empty())
+				continue;
+
+			decimator.reset(dataOrigin, xScale, yScale);
+			decimator.add(ser.data, ser.data.size());
+			decimator.finish();
+			const std::vector<ofVec3f> &line = decimator.getLine();
+
+			if(ser.fillPlot){
+				// Fill between the line and the horizontal axis (dependent variable = 0)
+				fill = line;
+				fill.push_back(ofVec3f(line.back().x, dataOrigin.y, 0));
+				fill.push_back(ofVec3f(line.front().x, dataOrigin.y, 0));
+				canvas.fillPolygon(fill, ser.lineColor);
+			}else{
+				canvas.drawLineStrip(line, ser.lineColor, ser.lineWidth);
+			}
+		}
+	}
+
+	// Axes
+	float plot_x = plotArea.x;
+	float plot_y = plotArea.y + plotArea.height;	// Bottom-left corner of the area within the axes
+	indAxis.drawTo(canvas, ofVec2f(plot_x, dataOrigin.y), ofVec2f(plot_x + plotArea.width, dataOrigin.y), 10);
+	depAxis.drawTo(canvas, ofVec2f(dataOrigin.x, plot_y), ofVec2f(dataOrigin.x, plot_y - plotArea.height), 10);
+
+	const std::vector<ofVec3f> &ticks = tickMesh.getVertices();
+	for(size_t i = 0; i + 1 < ticks.size(); i += 2){
+		canvas.drawLine(ticks[i], ticks[i + 1], axesColor, 1);
+	}
+
+	// Labels
+	std::function<ofRectangle(const std::string&)> measure;
+	if(canvas.hasFont())
+		measure = [&canvas](const std::string &str){ return canvas.getStringBoundingBox(str); };
+
+	Labels lbl;
+	getLabels(lbl, measure);
+	std::vector<ofVec2f> tickPts;
+	getTickLabelPts(tickPts, measure);
+
+	canvas.drawText(title, lbl.title.x, lbl.title.y, textColor, false);
+	canvas.drawText(xlabel, lbl.xlabel.x, lbl.xlabel.y, textColor, false);
+	canvas.drawText(ylabel, lbl.ylabel.x, lbl.ylabel.y, textColor, true);
+	for(size_t i = 0; i < tickPts.size(); i++){
+		const std::string &str = i < xTicks.size() ? xTicks[i].label : yTicks[i - xTicks.size()].label;
+		canvas.drawText(str, tickPts[i].x, tickPts[i].y, axesColor, false);
+	}
+
+	// Highlights and selection
+	if(!visibleHighlights.empty()){
+		const std::vector<ofxPlotRangeSet::range_t> &ranges = visibleHighlights.getRanges();
+		for(size_t s = 0; s < series.size(); s++){
+			const std::vector<dataPt> &data = series[s].data;
+			for(size_t r = 0; r < ranges.size() && ranges[r].first < data.size(); r++){
+				for(size_t i = ranges[r].first; i < std::min(ranges[r].second, data.size()); i++){
+					canvas.drawCircle(dataToScreen(data[i]), 4, ofColor::yellow, 2);
+				}
+			}
+		}
+
+		const dataPt *value = getCrossHairPt();
+		if(value){
+			ofVec2f pt = dataToScreen(*value);
+			canvas.drawLine(ofVec2f(plot_x, pt.y), ofVec2f(plot_x + plotArea.width, pt.y), axesColor, 1);
+			canvas.drawLine(ofVec2f(pt.x, plot_y), ofVec2f(pt.x, plot_y - plotArea.height), axesColor, 1);
+			canvas.drawText(valueStr, lbl.value.x, lbl.value.y, axesColor, false);
+		}
+	}
+
+	if(!selectedArea.isZero()){
+		ofRectangle sel = selectedArea.getStandardized();
+		canvas.drawLine(sel.getTopLeft(), sel.getTopRight(), axesColor, 1);
+		canvas.drawLine(sel.getTopRight(), sel.getBottomRight(), axesColor, 1);
+		canvas.drawLine(sel.getBottomRight(), sel.getBottomLeft(), axesColor, 1);
+		canvas.drawLine(sel.getBottomLeft(), sel.getTopLeft(), axesColor, 1);
+	}
+
+	canvas.end();
+}//====================================================
+
+/**
+ *  @brief Write the plot as a standalone SVG document
+ *  @details Text is sized to match the plot's font, if one is loaded. No
+ *  OpenGL calls are made.
+ *  @param out stream to write the document to
+ *  @see drawTo(), ofxPlotExport
+ */
+void ofxPlot::writeSVG(std::ostream &out){
+	ofxPlotSVG svg(out, font);
+	drawTo(svg);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add a data series to the plot
+ *  @details All series share the plot's axes. New series are assigned
+ *  colors from a built-in palette; use the setSeries... functions to
+ *  change their style.
+ * 
+ *  @param name name of the series
+ *  @return the index of the new series
+ */
+size_t ofxPlot::addSeries(std::string name){
+	static const ofColor palette[] = {
+		ofColor(125, 125, 255), ofColor(255, 150, 80), ofColor(110, 210, 120), ofColor(230, 90, 110),
+		ofColor(180, 130, 230), ofColor(90, 200, 210), ofColor(230, 210, 90), ofColor(200, 200, 200)
+	};
+
+	ofxPlotSeries s;
+	s.name = name;
+	s.lineColor = palette[series.size() % (sizeof(palette)/sizeof(palette[0]))];
+	series.push_back(s);
+	dataVersion++;
+	bRefinementStale = true;
+
+	return series.size() - 1;
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of data points in the plot
+ *  @return the number of points, summed over all series
+ */
+size_t ofxPlot::getNumPoints() const{
+	size_t n = 0;
+	for(size_t s = 0; s < series.size(); s++){
+		n += series[s].data.size();
+	}
+	return n;
+}//====================================================
+
+/**
+ *  @brief Determine whether the plot must be redrawn
+ *  @details Besides changes to its appearance, the plot stays dirty while
+ *  progressive refinement has data left to refine or line geometry is being
+ *  built in the background, so that cached draws keep preparing it and pick
+ *  up each refined chunk or completed build
+ *  @return whether or not the plot must be redrawn
+ *  @see InteractiveObj::drawCached()
+ */
+bool ofxPlot::needsRedraw() const{
+	return InteractiveObj::needsRedraw() || bRefinementPending || pendingGeometry.valid();
+}//====================================================
+
+/**
+ *  @brief Retrieve the bytes held by the plot, broken down by buffer
+ *  @details Each series' buffers are listed separately. The path built by
+ *  the CPU draw path is estimated at about 72 bytes per point (the path
+ *  commands plus the outline openFrameworks derives from them).
+ *  @return the buffers held by the plot
+ *  @see InteractiveObj::getMemoryUsage()
+ */
+ofxPlotMemory ofxPlot::getMemoryUsage() const{
+	ofxPlotMemory mem = InteractiveObj::getMemoryUsage();
+	forEachBuffer([&mem](size_t s, const char *name, size_t bytes, bool gpu){
+		if(s == std::string::npos)
+			mem.add(name, bytes, gpu);
+		else
+			mem.add("series " + ofToString(s) + " " + name, bytes, gpu);
+	});
+	return mem;
+}//====================================================
+
+/**
+ *  @brief Retrieve the bytes held by the plot's data and the buffers
+ *  derived from them
+ *  @details This is the part of getMemoryUsage() that excludes the base
+ *  class, summed without building a labeled report
+ *  @return the number of bytes, main memory plus GPU
+ */
+size_t ofxPlot::getDataMemoryUsage() const{
+	size_t total = 0;
+	forEachBuffer([&total](size_t, const char*, size_t bytes, bool){ total += bytes; });
+	return total;
+}//====================================================
+
+/**
+ *  @brief Pass each buffer held by the plot (but not the base class) to a function
+ *  @details getMemoryUsage() labels the buffers, while the memory cap only
+ *  sums them; both list them here so that they cannot disagree
+ * 
+ *  @param add function called with the index of the series that holds the
+ *  buffer (std::string::npos if it is not held by a series), the name of the
+ *  buffer, its size in bytes, and whether it is held by the GPU
+ */
+void ofxPlot::forEachBuffer(const std::function<void(size_t, const char*, size_t, bool)> &add) const{
+	const size_t none = std::string::npos;
+
+	bool hasSizes = false, hasColors = false;
+	for(size_t s = 0; s < series.size(); s++){
+		const ofxPlotSeries &ser = series[s];
+
+		add(s, "data", ofxPlotMemory::bytesOf(ser.data), false);
+		add(s, "screen coordinates", ofxPlotMemory::bytesOf(ser.displayData), false);
+		if(ser.bDisplayDataValid)
+			add(s, "path", ser.displayData.size()*72, false);
+		add(s, "point sizes", ofxPlotMemory::bytesOf(ser.ptSizes), false);
+		add(s, "point colors", ofxPlotMemory::bytesOf(ser.ptColors), false);
+		add(s, "modified ranges", ofxPlotMemory::bytesOf(ser.dirtyPts.getRanges()) +
+			ofxPlotMemory::bytesOf(ser.snapshotDirtyPts.getRanges()), false);
+		if(ser.snapshot)
+			add(s, "snapshot", ofxPlotMemory::bytesOf(*ser.snapshot), false);
+		add(s, "refinement", ser.refinement.getMemoryUsage(), false);
+		add(s, "refinement mesh", ofxPlotMemory::bytesOf(ser.refinementMesh), false);
+		add(s, "refinement mesh", ofxPlotMemory::bytesOf(ser.refinementMesh), true);
+
+		hasSizes = hasSizes || !ser.ptSizes.empty();
+		hasColors = hasColors || !ser.ptColors.empty();
+	}
+
+	if(highlightPtIxs)
+		add(none, "highlights (shared)", ofxPlotMemory::bytesOf(highlightPtIxs->getRanges()), false);
+	add(none, "visible highlights", ofxPlotMemory::bytesOf(visibleHighlights.getRanges()), false);
+	add(none, "highlight mesh", ofxPlotMemory::bytesOf(highlightMesh), false);
+	add(none, "highlight mesh", ofxPlotMemory::bytesOf(highlightMesh), true);
+	add(none, "grid mesh", ofxPlotMemory::bytesOf(gridMesh) + ofxPlotMemory::bytesOf(tickMesh), false);
+	add(none, "grid mesh", ofxPlotMemory::bytesOf(gridMesh) + ofxPlotMemory::bytesOf(tickMesh), true);
+
+	add(none, "data VBO", vboCapacity*sizeof(ofVec2f), true);
+	add(none, "fill VBO", 2*vboCapacity*sizeof(ofVec2f), true);
+	if(plotStyle == ofxPlotStyle::SCATTER && bGPUTransform){
+		add(none, "point size VBO", hasSizes ? vboCapacity*sizeof(float) : 0, true);
+		add(none, "point color VBO", hasColors ? vboCapacity*sizeof(ofFloatColor) : 0, true);
+	}
+
+	add(none, "density grid", densityGrid.getMemoryUsage(), false);
+	add(none, "density pixels", densityPix.getWidth()*densityPix.getHeight()*densityPix.getNumChannels(), false);
+	if(densityTex.isAllocated())
+		add(none, "density texture", (size_t)densityTex.getWidth()*(size_t)densityTex.getHeight()*4, true);
+
+	if(frontGeometry)
+		add(none, "background geometry", frontGeometry->getMemoryUsage(), false);
+	for(size_t s = 0; s < asyncLineMeshes.size(); s++){
+		size_t bytes = ofxPlotMemory::bytesOf(asyncLineMeshes[s]) + ofxPlotMemory::bytesOf(asyncFillMeshes[s]);
+		add(s, "background mesh", bytes, false);
+		add(s, "background mesh", bytes, true);
+	}
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of data series in the plot
+ *  @return the number of data series; there is always at least one
+ */
+size_t ofxPlot::getNumSeries() const { return series.size(); }
+
+/**
+ *  @brief Add a data point to the plot
+ * 
+ *  @param ind independent variable value (horizontal axis)
+ *  @param dep dependent variable value (vertical axis)
+ */
+void ofxPlot::addDataPt(double ind, double dep){
+	addDataPt(0, dataPt(ind, dep));
+}//====================================================
+
+/**
+ *  @brief Add a data point to th plot
+ * 
+ *  @param pt data point
+ *  @see addDataPt(double, double)
+ */
+void ofxPlot::addDataPt(dataPt pt){
+	addDataPt(0, pt);
+}//====================================================
+
+/**
+ *  @brief Add a data point to a series
+ * 
+ *  @param s index of the series
+ *  @param ind independent variable value (horizontal axis)
+ *  @param dep dependent variable value (vertical axis)
+ */
+void ofxPlot::addDataPt(size_t s, double ind, double dep){
+	addDataPt(s, dataPt(ind, dep));
+}//====================================================
+
+/**
+ *  @brief Add a data point to a series
+ * 
+ *  @param s index of the series
+ *  @param pt data point
+ */
+void ofxPlot::addDataPt(size_t s, dataPt pt){
+	if(!isValidSeries(s))
+		return;
+
+	series[s].addDataPt(pt);
+	if(visibleHighlights.contains(series[s].data.size() - 1))
+		bHighlightMeshValid = false;
+
+	dataVersion++;
+	bDensityValid = false;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Modify an existing data point
+ *  @details Only the modified point is re-transformed and re-uploaded
+ *  the next time the plot is drawn
+ * 
+ *  @param ix index of the data point
+ *  @param ind independent variable value (horizontal axis)
+ *  @param dep dependent variable value (vertical axis)
+ */
+void ofxPlot::setDataPt(size_t ix, double ind, double dep){
+	setDataPts(0, ix, std::vector<dataPt>(1, dataPt(ind, dep)));
+}//====================================================
+
+/**
+ *  @brief Modify an existing data point
+ * 
+ *  @param ix index of the data point
+ *  @param pt new data point
+ *  @see setDataPt(size_t, double, double)
+ */
+void ofxPlot::setDataPt(size_t ix, dataPt pt){
+	setDataPts(0, ix, std::vector<dataPt>(1, pt));
+}//====================================================
+
+/**
+ *  @brief Modify an existing data point in a series
+ * 
+ *  @param s index of the series
+ *  @param ix index of the data point
+ *  @param pt new data point
+ *  @see setDataPt(size_t, double, double)
+ */
+void ofxPlot::setDataPt(size_t s, size_t ix, dataPt pt){
+	setDataPts(s, ix, std::vector<dataPt>(1, pt));
+}//====================================================
+
+/**
+ *  @brief Modify a contiguous span of existing data points
+ * 
+ *  @param first index of the first data point to modify
+ *  @param pts new data points; the span must lie within the existing data
+ *  @see setDataPts(size_t, size_t, const std::vector<dataPt>&)
+ */
+void ofxPlot::setDataPts(size_t first, const std::vector<dataPt> &pts){
+	setDataPts(0, first, pts);
+}//====================================================
+
+/**
+ *  @brief Modify a contiguous span of existing data points in a series
+ *  @details The modified span is recorded so that only those points are
+ *  re-transformed and re-uploaded the next time the plot is drawn. The data
+ *  extents are expanded as needed; they are only recomputed from scratch if a
+ *  point that defined one of the extents moves inward.
+ * 
+ *  @param s index of the series
+ *  @param first index of the first data point to modify
+ *  @param pts new data points; the span must lie within the existing data
+ */
+void ofxPlot::setDataPts(size_t s, size_t first, const std::vector<dataPt> &pts){
+	if(!isValidSeries(s))
+		return;
+
+	if(!series[s].setDataPts(first, pts)){
+		ofLogWarning("ofxPlot") << "setDataPts: span [" << first << ", " << first + pts.size()
+			<< ") is outside series " << s << ", which has " << series[s].data.size() << " points";
+		return;
+	}
+
+	if(visibleHighlights.intersects(first, first + pts.size()))
+		bHighlightMeshValid = false;
+
+	if(first < series[s].refinement.getCount())
+		series[s].refinement.restart();
+
+	dataVersion++;
+	bDensityValid = false;
+	requestRedraw();
 }//====================================================
 
-//-----------------------------------------------------------------------------
-// -- Graphics --
-//-----------------------------------------------------------------------------
+/**
+ *  @brief Remove all data from the plot
+ *  @details The series, and their styles, are preserved
+ */
+void ofxPlot::clearData(){
+	for(size_t s = 0; s < series.size(); s++){
+		series[s].clear();
+		series[s].vboCapacity = 0;	// Lay out again, with a new offset, on the next upload
+	}
+
+	vboCapacity = 0;
+	dataVersion++;
+	bDensityValid = false;
+	requestRedraw();
+}//====================================================
 
 /**
- *  @brief Draw the plot
+ *  @brief Remove all data from a series
+ *  @param s index of the series
  */
-void ofxPlot::draw(){
-	InteractiveObj::draw();
+void ofxPlot::clearData(size_t s){
+	if(!isValidSeries(s))
+		return;
 
-	ofDisableDepthTest();
-	ofPushStyle();
+	series[s].clear();
+	dataVersion++;
+	bDensityValid = false;
+	bHighlightMeshValid = false;
+	requestRedraw();
+}//====================================================
 
-	// Plot window properties
-	float win_x = viewport.getX();			// top-left corner, increases to the right
-	float win_y = viewport.getY();			// top-left corner, increases to the bottom
-	float win_w = viewport.getWidth();
-	float win_h = viewport.getHeight();
+/**
+ *  @brief Read series 0 from a shared memory ring
+ *  @see attachSharedRing(size_t, const std::string&)
+ *  @param name name of the ring
+ *  @return whether or not the ring was opened
+ */
+bool ofxPlot::attachSharedRing(const std::string &name){
+	return attachSharedRing(0, name);
+}//====================================================
 
-    // Characteristics of the area that information is plotted in
-    float plot_w = win_w - 2*padding;       // Width of the area within the axes
-    float plot_h = win_h - 2*padding;       // Height of the area within the axes
-    float plot_x = win_x + padding;         // Bottom-left corner of area within the axes
-    float plot_y = win_y + win_h - padding;     // Bottom-left corner of the area within the axes
-    
-    // Get maximum data extents
-    float maxX = 0, minX = 0, maxY = 0, minY = 0;
-    for(size_t i = 0; i < data.size(); i++){
-        if(i == 0){
-            maxX = data[i].indVar;
-            minX = maxX;
-            maxY = data[i].depVar;
-            minY = maxY;
-        }else{
-            maxX = data[i].indVar > maxX ? data[i].indVar : maxX;
-            minX = data[i].indVar < minX ? data[i].indVar : minX;
-            maxY = data[i].depVar > maxY ? data[i].depVar : maxY;
-            minY = data[i].depVar < minY ? data[i].depVar : minY;
-        }
-    }
-	
-	// Zero MUST be part of the data set
-	// ToDo (perhaps): allow axes to represent values other than x = 0 or y = 0
-    maxX = maxX > 0 ? maxX : 0;
-    minX = minX < 0 ? minX : 0;
-    maxY = maxY > 0 ? maxY : 0;
-    minY = minY < 0 ? minY : 0;
-    
-    // Determine scaling amounts so that data will fit in plot area
-    double xScale = plot_w/(maxX - minX);
-    double yScale = plot_h/(maxY - minY);
-    
-    // Place axes to use as much of the plot area as possible
-    float dataOrigin_x = plot_x - minX*xScale;
-    float dataOrigin_y = plot_y + minY*yScale;
-    
-    // Draw axes
-	indAxis.draw(ofVec2f(plot_x, dataOrigin_y), ofVec2f(plot_x + plot_w, dataOrigin_y), 10);
-	depAxis.draw(ofVec2f(dataOrigin_x, plot_y), ofVec2f(dataOrigin_x, plot_y - plot_h), 10);
-
-    // Draw title, axes labels
-	ofSetColor(textColor);
-	if(font.isLoaded()){
-		ofRectangle titleBox = font.getStringBoundingBox(title, 0,0);
-		font.drawString(title, plot_x + 0.5*(plot_w - titleBox.width), plot_y - plot_h - 5);
-		ofRectangle xLblBox = font.getStringBoundingBox(xlabel, 0,0);
-		font.drawString(xlabel, plot_x + 0.5*(plot_w - xLblBox.width), plot_y + padding - 5);
-	}else{
-		ofDrawBitmapString(title, plot_x + 0.5*plot_w, win_y + padding - 5);
-		ofDrawBitmapString(xlabel, plot_x + 0.5*plot_w, win_y + win_h - 5);
+/**
+ *  @brief Read a series from a shared memory ring
+ *  @details The ring is opened read-only; a producer process creates it and
+ *  publishes samples to it (see ofxPlotSharedRing). Each update() appends
+ *  the samples published since the previous update to the series, copying
+ *  each sample once, directly from the shared memory into the series. The
+ *  samples still in the ring when it is attached are read first. Samples
+ *  that the producer overwrites before the plot reads them are skipped.
+ * 
+ *  Points may still be added to the series, modified, or cleared as usual.
+ * 
+ *  @param s index of the series
+ *  @param name name of the ring
+ *  @return whether or not the ring was opened; if not, the series keeps
+ *  any ring it was already reading
+ */
+bool ofxPlot::attachSharedRing(size_t s, const std::string &name){
+	if(!isValidSeries(s))
+		return false;
+
+	std::shared_ptr<ofxPlotSharedRing> ring = std::make_shared<ofxPlotSharedRing>();
+	if(!ring->open(name)){
+		ofLogWarning("ofxPlot") << "attachSharedRing: " << ring->getError();
+		return false;
 	}
 
-	ofPushMatrix();
-	ofRotate(-90, 0, 0, 1);						// Rotate camera for vertical axis
-	if(font.isLoaded()){
-		ofRectangle yLblBox = font.getStringBoundingBox(ylabel, 0,0);
-		font.drawString(ylabel, -plot_y - padding + 0.5*(plot_h - 2*yLblBox.height), plot_x - 5);
-	}else{
-		ofSetDrawBitmapMode(OF_BITMAPMODE_MODEL);	// This allows the bitmapString to rotate
-		ofDrawBitmapString(ylabel, -plot_y - padding + 0.5*(plot_h - 2*padding), plot_x - 5);
+	series[s].ring = ring;
+	series[s].ringCursor = 0;
+	return true;
+}//====================================================
+
+/**
+ *  @brief Stop reading series 0 from a shared memory ring
+ *  @details The samples already read are kept
+ */
+void ofxPlot::detachSharedRing(){ detachSharedRing(0); }
+
+/**
+ *  @brief Stop reading a series from a shared memory ring
+ *  @details The samples already read are kept
+ *  @param s index of the series
+ */
+void ofxPlot::detachSharedRing(size_t s){
+	if(isValidSeries(s))
+		series[s].ring.reset();
+}//====================================================
+
+/**
+ *  @brief Append the samples published to each attached ring since the
+ *  last read to their series
+ */
+void ofxPlot::readSharedRings(){
+	for(size_t s = 0; s < series.size(); s++){
+		ofxPlotSeries &sr = series[s];
+		if(!sr.ring)
+			continue;
+
+		size_t first = sr.data.size();
+		if(sr.ring->read(sr.ringCursor, sr.data) == 0)
+			continue;
+
+		sr.expandExtents(first);
+		if(visibleHighlights.intersects(first, sr.data.size()))
+			bHighlightMeshValid = false;
+
+		dataVersion++;
+		bDensityValid = false;
+		requestRedraw();
 	}
-	ofPopMatrix();
+}//====================================================
 
-	// Draw data
-	displayData.clear();
-	displayData.assign(data.size(), ofVec2f(0,0));
+/**
+ *  @brief Tell the plot whether to build the line geometry in the background
+ *  @details Transforming and meshing a very large series can block the render
+ *  thread for longer than a frame. When enabled, the line style is built on a
+ *  background thread from a snapshot of the data: the points are decimated to
+ *  at most four per pixel column, and a spatial index is built for hover and
+ *  rectangle selection. The plot draws the most recently completed geometry,
+ *  so rendering is never blocked by ingestion or resizes, and the drawn data
+ *  lag the actual data by at most one build. The snapshot doubles the memory
+ *  used by the data.
+ * 
+ *  @param async whether or not to build the line geometry in the background
+ */
+void ofxPlot::setAsyncGeometry(bool async){
+	if(async == bAsyncGeometry)
+		return;
 
-	if(data.size() > 0){
+	bAsyncGeometry = async;
+	if(!async){
+		// Wait for any build in progress, then free the geometry and snapshots
+		if(pendingGeometry.valid())
+			pendingGeometry.wait();
 
-		ofPath dataPath;
-		for(size_t i = 0; i < data.size(); i++){
-			displayData[i] = ofVec2f(dataOrigin_x + xScale*data[i].indVar, dataOrigin_y - yScale*data[i].depVar);
-			if(i == 0)
-				dataPath.moveTo(displayData[i]);
-			else
-				dataPath.lineTo(displayData[i]);
-		}
-		dataPath.setColor(lineColor);
-		
-		dataPath.setFilled(fillPlot);
-        if(!fillPlot){
-			dataPath.setStrokeWidth(lineWidth);
-        }else{
-			dataPath.close();
-        }
-        
-		dataPath.draw();
-	}
-
-	if(!highlightPtIxs.empty()){
-		ofNoFill();
-		ofSetColor(ofColor::yellow);
-		ofSetLineWidth(2);
-
-		size_t ix;
-		for(size_t i = 0; i < highlightPtIxs.size(); i++){
-			ix = highlightPtIxs[i];
-			ofDrawCircle(displayData[ix], 4);
+		pendingGeometry = std::future<std::shared_ptr<const ofxPlotGeometry> >();
+		frontGeometry.reset();
+		asyncLineMeshes.clear();
+		asyncFillMeshes.clear();
+		for(size_t s = 0; s < series.size(); s++){
+			series[s].snapshot.reset();
+			series[s].snapshotDirtyPts.clear();
 		}
-		ofSetLineWidth(1);
+		invalidateGeometry();
+	}
 
-        // Draw big cross hairs on the last selected point
-		ofSetColor(axesColor);
-		ofSetLineWidth(1);
-        ofDrawLine(ofVec2f(plot_x, displayData[ix].y), ofVec2f(plot_x + plot_w, displayData[ix].y));
-        ofDrawLine(ofVec2f(displayData[ix].x, plot_y), ofVec2f(displayData[ix].x, plot_y - plot_h));
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Tell the plot whether to coalesce pointer input
+ *  @details Mice and touchpads may deliver several move or drag events per
+ *  frame, and each one triggers a nearest-point search or a rectangle
+ *  selection along with a selection event. When coalescing is enabled, the
+ *  event handlers only record the latest pointer location and update()
+ *  processes it once. update() must be called each frame for the plot to
+ *  respond to the mouse.
+ * 
+ *  @param coalesce whether or not to coalesce pointer input
+ */
+void ofxPlot::setCoalesceInput(bool coalesce){
+	if(!coalesce)
+		flushPendingInput();
+
+	bCoalesceInput = coalesce;
+}//====================================================
+
+/**
+ *  @brief Tell the plot whether or not to fill the plot area
+ * 
+ *  @param fill whether or not to fill the plot area, i.e., the
+ *  area under the plotted curve
+ *  @see setSeriesFill()
+ */
+void ofxPlot::setFillPlot(bool fill){ setSeriesFill(0, fill); }
 
-        // Print out data value
-        char dataStr[128];
-        sprintf(dataStr, "(%.4f, %.4f)", data[ix].indVar, data[ix].depVar);
-        if(font.isLoaded()){
-        	ofRectangle dataBox = font.getStringBoundingBox(dataStr, 0,0);
-        	font.drawString(dataStr, plot_x + plot_w - padding - dataBox.width, plot_y + padding - 5);
-        }else{
-        	ofDrawBitmapString(dataStr, plot_x + plot_w - 125 - padding, plot_y + padding - 5);
-        }
+/**
+ *  @brief Tell the plot whether to apply the data transform on the GPU
+ *  @details When enabled, the data are uploaded to a vertex buffer once and
+ *  the transform to screen coordinates is applied in a vertex shader, so
+ *  resizing the viewport or changing the data extents does not require any
+ *  per-point work. When filled, the area between the curve and the horizontal
+ *  axis is shaded.
+ * 
+ *  @param useGPU whether or not to apply the data transform on the GPU
+ */
+void ofxPlot::setGPUTransform(bool useGPU){
+	if(!useGPU && bGPUTransform){
+		// Free the GPU memory; the CPU path caches must be rebuilt
+		dataVbo.clear();
+		fillVbo.clear();
+		vboCapacity = 0;
+		for(size_t s = 0; s < series.size(); s++){
+			series[s].vboCapacity = 0;
+			series[s].vboCount = 0;
+		}
+		invalidateGeometry();
 	}
 
-	if(!selectedArea.isZero()){
-		ofSetColor(axesColor);
-		ofNoFill();
-		ofSetLineWidth(1);
-		ofDrawRectangle(selectedArea);
+	if(useGPU != bGPUTransform)
+		requestRedraw();
+
+	bGPUTransform = useGPU;
+}//====================================================
+
+/**
+ *  @brief Set the data points to highlight
+ *  @param ixs indices of the points to highlight; indices are shared
+ *  by all series
+ */
+void ofxPlot::setHighlightedPts(std::vector<int> ixs){
+	std::shared_ptr<ofxPlotRangeSet> set = std::make_shared<ofxPlotRangeSet>();
+	for(size_t i = 0; i < ixs.size(); i++){
+		if(ixs[i] >= 0)
+			set->add(ixs[i]);
 	}
+	setHighlightedPts(set);
+}//====================================================
 
-	ofPopStyle();
-	ofEnableDepthTest();
+/**
+ *  @brief Set the data points to highlight without copying them
+ *  @param ixs pointer to the indices of the points to highlight, which
+ *  must not be modified while the plot holds them; nullptr to clear the
+ *  highlights
+ */
+void ofxPlot::setHighlightedPts(std::shared_ptr<const ofxPlotRangeSet> ixs){
+	if(ixs == highlightPtIxs)
+		return;
+
+	highlightPtIxs = ixs;
+	updateVisibleHighlights();
 }//====================================================
 
-//-----------------------------------------------------------------------------
-// -- Set and Get Functions --
-//-----------------------------------------------------------------------------
+/**
+ *  @brief Tell the plot whether to draw gridlines
+ *  @param b whether or not gridlines are drawn through the ticks, across the
+ *  plot area; true by default
+ *  @see setGridColor(), setTickSpacing()
+ */
+void ofxPlot::setGridLines(bool b){ bGridLines = b; requestRedraw(); }
 
 /**
- *  @brief Add a data point to the plot
+ *  @brief Set the colors used to represent data density
+ *  @param colors at least two colors, from lowest (empty) to highest density
+ *  @see ofxPlotDensityGrid::setColorMap
+ */
+void ofxPlot::setDensityColorMap(std::vector<ofColor> colors){
+	densityGrid.setColorMap(colors);
+	bDensityValid = false;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Set the diameter of the scatter markers
+ *  @details This size applies to all points that do not have
+ *  their own size; see setPointSizes()
  * 
- *  @param ind independent variable value (horizontal axis)
- *  @param dep dependent variable value (vertical axis)
+ *  @param size marker diameter, pixels
+ *  @see setSeriesMarkerSize()
  */
-void ofxPlot::addDataPt(double ind, double dep){
-	data.push_back(dataPt(ind, dep));
+void ofxPlot::setMarkerSize(float size){ setSeriesMarkerSize(0, size); }
+
+/**
+ *  @brief Limit the memory the plot may hold
+ *  @details The cap is checked in update(). When the plot holds more than
+ *  the cap, as reported by getMemoryUsage(), its data are reduced by the
+ *  policy until they use about half of what the cap allows:
+ *  - EVICT_OLDEST removes the first points of each series, e.g., for a
+ *  scrolling history
+ *  - DECIMATE keeps the first and last points and the smallest and largest
+ *  value of each run of points, so peaks survive; the whole series loses
+ *  resolution each time the cap is reached
+ * 
+ *  Indices of the remaining points change, so highlights and selections
+ *  made by index refer to different points afterward.
+ * 
+ *  @param bytes the cap, in bytes (main memory plus GPU); zero for no cap
+ *  @param policy how the data are reduced
+ */
+void ofxPlot::setMemoryCap(size_t bytes, ofxPlotMemoryPolicy policy){
+	memoryCap = bytes;
+	memoryPolicy = policy;
 }//====================================================
 
 /**
- *  @brief Add a data point to th plot
+ *  @brief Set the color of each scatter marker
+ *  @param colors marker colors
+ *  @see setPointColors(size_t, std::vector<ofColor>)
+ */
+void ofxPlot::setPointColors(std::vector<ofColor> colors){ setPointColors(0, colors); }
+
+/**
+ *  @brief Set the color of each scatter marker in a series
+ *  @details Element i colors data point i; points beyond the end of the
+ *  vector are drawn in the series color. Pass an empty vector to draw all
+ *  markers in the series color. The colors are cleared with the data.
  * 
- *  @param pt data point
- *  @see addDataPt(double, double)
+ *  @param s index of the series
+ *  @param colors marker colors
  */
-void ofxPlot::addDataPt(dataPt pt){
-    data.push_back(pt);
+void ofxPlot::setPointColors(size_t s, std::vector<ofColor> colors){
+	if(!isValidSeries(s))
+		return;
+
+	series[s].ptColors.assign(colors.begin(), colors.end());
+	bPtAttribsDirty = true;
+	requestRedraw();
 }//====================================================
 
-void ofxPlot::clearData(){
-	data.clear();
+/**
+ *  @brief Set the diameter of each scatter marker
+ *  @param sizes marker diameters, pixels
+ *  @see setPointSizes(size_t, std::vector<float>)
+ */
+void ofxPlot::setPointSizes(std::vector<float> sizes){ setPointSizes(0, sizes); }
+
+/**
+ *  @brief Set the diameter of each scatter marker in a series
+ *  @details Element i sizes data point i; points beyond the end of the
+ *  vector, or with non-positive sizes, use the series' marker size. Pass an
+ *  empty vector to draw all markers at the marker size. The sizes are cleared
+ *  with the data.
+ * 
+ *  @param s index of the series
+ *  @param sizes marker diameters, pixels
+ *  @see setSeriesMarkerSize()
+ */
+void ofxPlot::setPointSizes(size_t s, std::vector<float> sizes){
+	if(!isValidSeries(s))
+		return;
+
+	series[s].ptSizes = sizes;
+	bPtAttribsDirty = true;
+	requestRedraw();
 }//====================================================
 
 /**
- *  @brief Tell the plot whether or not to fill the plot area
+ *  @brief Set how the data are rendered
+ *  @details The scatter style draws each point as a marker, which suits
+ *  unordered measurements; hover and rectangle selection behave exactly as
+ *  they do for the line style. The density style is best suited to very large
+ *  data sets where many points map to the same pixels: rather than overdrawing
+ *  a line, each pixel is colored by the number of points within it. Binning is
+ *  a single multithreaded pass over the data and is only repeated when the
+ *  data or the transform change.
  * 
- *  @param fill whether or not to fill the plot area, i.e., the
- *  area under the plotted curve
+ *  @param style how the data are rendered
  */
-void ofxPlot::setFillPlot(bool fill){ fillPlot = fill; }
+void ofxPlot::setPlotStyle(ofxPlotStyle style){
+	if(style != plotStyle)
+		requestRedraw();
 
-void ofxPlot::setHighlightedPts(std::vector<int> ixs){
-	highlightPtIxs = ixs;
+	plotStyle = style;
+}//====================================================
+
+/**
+ *  @brief Refine the line style progressively within a per-frame time budget
+ *  @details When a scheduler is set, a coarse line through a sample of the
+ *  data is drawn immediately and then refined a little each frame, within the
+ *  time the scheduler grants, until it is decimated to full pixel fidelity.
+ *  Changes to the data range or the viewport restart the refinement. Share a
+ *  scheduler (e.g., ofxPlotScheduler::getShared()) among all widgets to bound
+ *  their combined per-frame work. Background geometry, if enabled, takes
+ *  precedence; see setAsyncGeometry().
+ * 
+ *  @param sched scheduler to acquire time from; nullptr to draw all of the
+ *  data each frame
+ */
+void ofxPlot::setScheduler(std::shared_ptr<ofxPlotScheduler> sched){
+	if(sched == scheduler)
+		return;
+
+	if(!sched){
+		for(size_t s = 0; s < series.size(); s++){
+			series[s].refinement.restart();
+			series[s].refinementMesh.clear();
+		}
+		invalidateGeometry();
+	}
+
+	scheduler = sched;
+	requestRedraw();
 }//====================================================
 
 /**
  *  @brief Set the horizontal axis label
  *  @param lbl
  */
-void ofxPlot::setXLabel(std::string lbl){ xlabel = lbl; }
+void ofxPlot::setXLabel(std::string lbl){ xlabel = lbl; requestRedraw(); }
 
 /**
  *  @brief Set the vertical axis label
  *  @param lbl
  */
-void ofxPlot::setYLabel(std::string lbl){ ylabel = lbl; }
+void ofxPlot::setYLabel(std::string lbl){ ylabel = lbl; requestRedraw(); }
 
 /**
  *  @brief Set the title string
  *  @param str
  */
-void ofxPlot::setTitle(std::string str){ title = str; }
+void ofxPlot::setTitle(std::string str){ title = str; requestRedraw(); }
+
+/**
+ *  @brief Set the approximate distance between axes ticks
+ *  @details Ticks are placed at 1, 2, or 5 times a power of ten, so the
+ *  actual distance is between one and about two and a half times this
+ *  @param px least distance between ticks, pixels; at least 10
+ */
+void ofxPlot::setTickSpacing(float px){
+	tickSpacing = std::max(px, 10.f);
+	bTicksValid = false;
+	requestRedraw();
+}//====================================================
 
 /**
  *  @brief Set the axes color
  *  @param c axes color
  */
-void ofxPlot::setAxesColor(ofColor c){ axesColor = c;}
+void ofxPlot::setAxesColor(ofColor c){ axesColor = c; requestRedraw(); }
 
 /**
  *  @brief Set the plot fill color, i.e., the color of the 
  *  fill under the curve
  *  @param c fill color
  */
-void ofxPlot::setFillColor(ofColor c){ fillColor = c;}
+void ofxPlot::setFillColor(ofColor c){ fillColor = c; requestRedraw(); }
+
+/**
+ *  @brief Set the gridline color
+ *  @param c gridline color; usually faint, so the data stand out
+ */
+void ofxPlot::setGridColor(ofColor c){ gridColor = c; requestRedraw(); }
 
 /**
  *  @brief Set the line color
  *  @param c line color
+ *  @see setSeriesColor()
  */
-void ofxPlot::setLineColor(ofColor c){ lineColor = c;}
+void ofxPlot::setLineColor(ofColor c){ setSeriesColor(0, c); }
 
 /**
  *  @brief Set the text color
  *  @param c text color
  */
-void ofxPlot::setTextColor(ofColor c){ textColor = c;}
+void ofxPlot::setTextColor(ofColor c){ textColor = c; requestRedraw(); }
+
+/**
+ *  @brief Set the line (and marker) color of a series
+ * 
+ *  @param s index of the series
+ *  @param c line color
+ */
+void ofxPlot::setSeriesColor(size_t s, ofColor c){
+	if(!isValidSeries(s))
+		return;
+
+	series[s].lineColor = c;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Tell a series whether or not to fill the area under its curve
+ *  @details The area is filled down to the horizontal axis, i.e., where
+ *  the dependent variable is zero
+ * 
+ *  @param s index of the series
+ *  @param fill whether or not to fill the area under the curve
+ */
+void ofxPlot::setSeriesFill(size_t s, bool fill){
+	if(!isValidSeries(s) || series[s].fillPlot == fill)
+		return;
+
+	series[s].fillPlot = fill;
+	series[s].bDisplayDataValid = false;
+	dataVersion++;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Set the line width of a series
+ *  @details Series that share a line width are drawn together
+ * 
+ *  @param s index of the series
+ *  @param w line width, pixels
+ */
+void ofxPlot::setSeriesLineWidth(size_t s, float w){
+	if(!isValidSeries(s) || series[s].lineWidth == w)
+		return;
+
+	series[s].lineWidth = w;
+	series[s].bDisplayDataValid = false;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Set the scatter marker diameter of a series
+ *  @details This size applies to all points in the series that
+ *  do not have their own size
+ * 
+ *  @param s index of the series
+ *  @param size marker diameter, pixels
+ */
+void ofxPlot::setSeriesMarkerSize(size_t s, float size){
+	if(!isValidSeries(s))
+		return;
+
+	series[s].markerSize = size;
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Set the name of a series
+ * 
+ *  @param s index of the series
+ *  @param name name of the series
+ */
+void ofxPlot::setSeriesName(size_t s, std::string name){
+	if(isValidSeries(s))
+		series[s].name = name;
+}//====================================================
+
+/**
+ *  @brief Determine whether addToBatch() can add the data to a batch
+ *  @details Only unfilled lines that are transformed on the CPU, whether
+ *  directly, progressively, or on a background thread, are plain line strips
+ *  @return whether or not the data can be batched
+ */
+bool ofxPlot::isDataBatchable() const{
+	if(plotStyle != ofxPlotStyle::LINE)
+		return false;
+
+	for(size_t s = 0; s < series.size(); s++){
+		if(series[s].fillPlot)
+			return false;
+	}
+
+	return bAsyncGeometry || scheduler || !(bGPUTransform && !bShaderFailed);
+}//====================================================
+
+/**
+ *  @brief Determine whether any series contains data
+ *  @return whether or not any series contains data
+ */
+bool ofxPlot::hasData() const{
+	for(size_t s = 0; s < series.size(); s++){
+		if(!series[s].data.empty())
+			return true;
+	}
+	return false;
+}//====================================================
+
+/**
+ *  @brief Determine whether a series index is valid, logging a
+ *  warning if it is not
+ * 
+ *  @param s index of the series
+ *  @return whether or not the series exists
+ */
+bool ofxPlot::isValidSeries(size_t s) const{
+	if(s < series.size())
+		return true;
 
+	ofLogWarning("ofxPlot") << "Series " << s << " does not exist; the plot has " << series.size() << " series";
+	return false;
+}//====================================================
 
 //-----------------------------------------------------------------------------
 // -- Event Handlers --
@@ -291,76 +2527,202 @@ void ofxPlot::setTextColor(ofColor c){ textColor = c;}
  *  @param mouse mouse event arguments
  */
 void ofxPlot::mouseMoved(ofMouseEventArgs &mouse){
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
 	InteractiveObj::mouseMoved(mouse);
 
+	if(bCoalesceInput){
+		pendingHoverPt = mouse;
+		bHoverPending = true;
+	}else{
+		processHover(mouse);
+	}
+}//====================================================
+
+void ofxPlot::mouseReleased(ofMouseEventArgs &mouse){
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
+	// Complete the selection before the drag ends
+	if(bDragPending){
+		bDragPending = false;
+		processDrag(pendingDragPt);
+	}
+
+	InteractiveObj::mouseReleased(mouse);
+
+	if(!selectedArea.isZero()){
+		selectedArea = ofRectangle(0,0,0,0);
+		requestRedraw();
+	}
+}//====================================================
+
+void ofxPlot::mouseDragged(ofMouseEventArgs &mouse){
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
+	if(isMousePressedInside){
+		if(bCoalesceInput){
+			pendingDragPt = mouse;
+			bDragPending = true;
+		}else{
+			processDrag(mouse);
+		}
+	}
+}//=====================================================
+
+/**
+ *  @brief Process the mouse move and drag recorded while coalescing input
+ */
+void ofxPlot::flushPendingInput(){
+	if(bHoverPending){
+		bHoverPending = false;
+		processHover(pendingHoverPt);
+	}
+
+	if(bDragPending){
+		bDragPending = false;
+		processDrag(pendingDragPt);
+	}
+}//====================================================
+
+/**
+ *  @brief Highlight the data point nearest to the mouse
+ *  @details The nearest point across all series is found and a selection
+ *  event is sent if it is close enough to the mouse; otherwise, a
+ *  deselection event is sent
+ * 
+ *  @param mouse mouse location, screen coordinates
+ */
+void ofxPlot::processHover(const ofVec2f &mouse){
 	// Only highlight points if the mouse is inside the view AND the mouse isn't being dragged
 	if(viewport.inside(mouse.x, mouse.y) && !isMouseDragged && heldKey == 'i'){
-		// Find nearest point
-		float minDist;
-		int minIx;
-		for(size_t i = 0; i < displayData.size(); i++){
-			ofVec2f dist = displayData[i] - mouse;
-
-			if(i == 0 || dist.length() < minDist){
-				minDist = dist.length();
-				minIx = i;
+		// Find nearest point in any series; with an index, only nearby points are visited
+		bool found = false;
+		float minDist = 0;
+		int minIx = 0;
+		size_t minSeries = 0;
+		ofRectangle near(mouse.x - maxSelectDist, mouse.y - maxSelectDist, 2*maxSelectDist, 2*maxSelectDist);
+		std::vector<size_t> candidates;
+		for(size_t s = 0; s < series.size(); s++){
+			const std::vector<dataPt> &data = series[s].data;
+			bool indexed = getIndexedCandidates(s, near, candidates);
+			size_t n = indexed ? candidates.size() : data.size();
+			for(size_t k = 0; k < n; k++){
+				size_t i = indexed ? candidates[k] : k;
+				float dist = (dataToScreen(data[i]) - mouse).length();
+
+				if(!found || dist < minDist){
+					minDist = dist;
+					minIx = i;
+					minSeries = s;
+					found = true;
+				}
 			}
 		}
 
+		if(!found && getIndexExtent() == 0)
+			return;
+
+		if(found && minDist < maxSelectDist){
+			ofxPlotRangeSet ixs;
+			ixs.add(minIx);
 
-		DataSelectedEventArgs args(minIx);
-		if(minDist < maxSelectDist){
-			ofNotifyEvent(DataSelectedEvent::selected, args);
+			if(minSeries != highlightSeries){
+				highlightSeries = minSeries;
+				requestRedraw();	// Cross hairs move to the new series
+			}
+			selectionGroup->select(ixs);
 		}else{
-			ofNotifyEvent(DataSelectedEvent::deselected, args);
+			selectionGroup->deselect();
 		}
 	}
 }//====================================================
 
-void ofxPlot::mouseReleased(ofMouseEventArgs &mouse){
-	InteractiveObj::mouseReleased(mouse);
-	selectedArea = ofRectangle(0,0,0,0);
-}//====================================================
+/**
+ *  @brief Update the rectangular selection area and select the data
+ *  within it
+ * 
+ *  @param mouse mouse location, screen coordinates
+ */
+void ofxPlot::processDrag(const ofVec2f &mouse){
+	// Limit mouse coordinates to the bounds of the viewport rectangle
+	float mX = mouse.x > viewport.x ? mouse.x : viewport.x;
+	float mY = mouse.y > viewport.y ? mouse.y : viewport.y;
+	
+	if(mX > viewport.x + viewport.width)
+		mX = viewport.x + viewport.width;
 
-void ofxPlot::mouseDragged(ofMouseEventArgs &mouse){
-	if(isMousePressedInside){
+	if(mY > viewport.y + viewport.height)
+		mY = viewport.y + viewport.height;
 
-		// Limit mouse coordinates to the bounds of the viewport rectangle
-		float mX = mouse.x > viewport.x ? mouse.x : viewport.x;
-		float mY = mouse.y > viewport.y ? mouse.y : viewport.y;
-		
-		if(mX > viewport.x + viewport.width)
-			mX = viewport.x + viewport.width;
-
-		if(mY > viewport.y + viewport.height)
-			mY = viewport.y + viewport.height;
-
-		// update rectangle
-		selectedArea.setPosition(std::min(mX, mousePressedPt.x), std::min(mY, mousePressedPt.y));	// top-left
-		selectedArea.setSize(std::max(mX, mousePressedPt.x) - selectedArea.x,
-			std::max(mY, mousePressedPt.y) - selectedArea.y);
-
-		// Update selection and send event
-		DataSelectedEventArgs args;
-		for(size_t i = 0; i < displayData.size(); i++){
-			if(selectedArea.inside(displayData[i].x, displayData[i].y)){
-				args.indices.push_back(i);
+	// update rectangle
+	ofRectangle area;
+	area.setPosition(std::min(mX, mousePressedPt.x), std::min(mY, mousePressedPt.y));	// top-left
+	area.setSize(std::max(mX, mousePressedPt.x) - area.x,
+		std::max(mY, mousePressedPt.y) - area.y);
+
+	if(area != selectedArea){
+		selectedArea = area;
+		requestRedraw();
+	}
+
+	// Update selection and send event; indices are shared by all series
+	ofxPlotRangeSet ixs;
+	std::vector<size_t> candidates;
+	for(size_t s = 0; s < series.size(); s++){
+		const std::vector<dataPt> &data = series[s].data;
+		bool indexed = getIndexedCandidates(s, selectedArea, candidates);
+		size_t n = indexed ? candidates.size() : data.size();
+		for(size_t k = 0; k < n; k++){
+			size_t i = indexed ? candidates[k] : k;
+			if(selectedArea.inside(dataToScreen(data[i]))){
+				ixs.add(i);
 			}
 		}
-		if(!args.indices.empty())
-			ofNotifyEvent(DataSelectedEvent::selected, args);
-
 	}
-}//=====================================================
 
+	if(!ixs.empty())
+		selectionGroup->select(ixs);
+}//====================================================
+
+/**
+ *  @brief Handle data selection events
+ *  @details Events this plot has already seen are ignored. The selection is
+ *  shared rather than copied, and the plot is only redrawn if the change
+ *  affects indices that exist in its data.
+ *  @param args data structure containing information about the event
+ */
 void ofxPlot::dataSelected(DataSelectedEventArgs &args){
-	setHighlightedPts(args.indices);
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
+	if(!isNewSelection(args))
+		return;
+
+	applySelection(args);
 }//====================================================
 
+/**
+ *  @brief Handle data deselection events
+ *  @param args data structure containing information about the event
+ *  @see dataSelected()
+ */
 void ofxPlot::dataDeselected(DataSelectedEventArgs &args){
-	std::vector<int> empty;
-	setHighlightedPts(empty);
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
+	if(!isNewSelection(args))
+		return;
+
+	applySelection(args);
 }//====================================================
 
+/**
+ *  @brief Adopt the selection carried by an event as the highlighted points
+ *  @details The selection is shared, not copied. If the event describes the
+ *  change from the previous selection and that change lies entirely outside
+ *  the data, the visible highlights cannot have changed and are not updated.
+ *  @param args data structure containing information about the event
+ */
+void ofxPlot::applySelection(DataSelectedEventArgs &args){
+	highlightPtIxs = args.indices;
 
+	size_t n = getIndexExtent();
+	if(!args.added || !args.removed || n != highlightExtent ||
+		args.added->intersects(0, n) || args.removed->intersects(0, n)){
 
+		updateVisibleHighlights();
+	}
+}//====================================================
@@ -26,42 +26,44 @@
 
 #pragma once
 
+#include "dataPt.hpp"
 #include "interactiveObj.hpp"
 #include "ofxPlotArrow.hpp"
+#include "ofxPlotDensityGrid.hpp"
+#include "ofxPlotGeometry.hpp"
+#include "ofxPlotRangeSet.hpp"
+#include "ofxPlotScheduler.hpp"
+#include "ofxPlotSeries.hpp"
 
 #include "ofMain.h"
 
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
 
 // Forward declarations
 class DataSelectedEventArgs;
+class ofxPlotCanvas;
 
 /**
- *  @brief Structure that contains values for a single data point
+ *  @brief Describes how the data are rendered
  */
-struct dataPt{
-	
-	/**
-	 *  @brief Construct a default data point
-	 */
-	dataPt(){}
-
-	/**
-	 *  @brief Construct a data point
-	 * 
-	 *  @param i independent variable value
-	 *  @param d dependent variable value
-	 */
-	dataPt(double i, double d) : indVar(i), depVar(d) {}
-
-	double indVar = 0;		//!< Independent Variable (e.g., time)
-	double depVar = 0;		//!< Dependent variable (e.g., altitude)
+enum class ofxPlotStyle{
+	LINE,		//!< Connected line through the data, optionally filled
+	SCATTER,	//!< Unconnected markers, one per data point
+	DENSITY		//!< Color-mapped count of the data points that fall within each pixel
 };
 
 /**
  *  @brief Plot object
+ *  @details A plot holds one or more data series that share a single set of
+ *  axes, labels, and event listeners. Series 0 always exists; functions that
+ *  do not take a series index operate on it.
  */
 class ofxPlot : public InteractiveObj{
 
@@ -69,28 +71,75 @@ public:
 	ofxPlot();
 	// ~ofxPlot();
 	
+	void update();
+	void prepare();
 	void draw();
 
+	bool addToBatch(ofxPlotBatch&);
+	void drawUnbatched();
+	void drawTo(ofxPlotCanvas&);
+	void writeSVG(std::ostream&);
+
+	size_t addSeries(std::string = "");
+	ofxPlotMemory getMemoryUsage() const;
+	size_t getNumPoints() const;
+	size_t getNumSeries() const;
+	bool needsRedraw() const;
+
 	void addDataPt(double, double);
 	void addDataPt(dataPt);
+	void addDataPt(size_t, double, double);
+	void addDataPt(size_t, dataPt);
+	bool attachSharedRing(const std::string&);
+	bool attachSharedRing(size_t, const std::string&);
 	void clearData();
+	void clearData(size_t);
+	void detachSharedRing();
+	void detachSharedRing(size_t);
+	void setDataPt(size_t, double, double);
+	void setDataPt(size_t, dataPt);
+	void setDataPt(size_t, size_t, dataPt);
+	void setDataPts(size_t, const std::vector<dataPt>&);
+	void setDataPts(size_t, size_t, const std::vector<dataPt>&);
 	
 	void enableKeyInput();
 	void enableMouseInput();
 	void disableKeyInput();
 	void disableMouseInput();
 
+	void setAsyncGeometry(bool);
+	void setCoalesceInput(bool);
 	void setFillPlot(bool);
+	void setGPUTransform(bool);
+	void setDensityColorMap(std::vector<ofColor>);
+	void setGridLines(bool);
+	void setMarkerSize(float);
+	void setMemoryCap(size_t, ofxPlotMemoryPolicy = ofxPlotMemoryPolicy::EVICT_OLDEST);
+	void setPlotStyle(ofxPlotStyle);
+	void setScheduler(std::shared_ptr<ofxPlotScheduler>);
+	void setPointColors(std::vector<ofColor>);
+	void setPointColors(size_t, std::vector<ofColor>);
+	void setPointSizes(std::vector<float>);
+	void setPointSizes(size_t, std::vector<float>);
 	void setHighlightedPts(std::vector<int>);
+	void setHighlightedPts(std::shared_ptr<const ofxPlotRangeSet>);
 	void setXLabel(std::string);
 	void setYLabel(std::string);
 	void setTitle(std::string);
+	void setTickSpacing(float);
 	
 	void setAxesColor(ofColor);
 	void setFillColor(ofColor);
+	void setGridColor(ofColor);
 	void setLineColor(ofColor);
 	void setTextColor(ofColor);
 
+	void setSeriesColor(size_t, ofColor);
+	void setSeriesFill(size_t, bool);
+	void setSeriesLineWidth(size_t, float);
+	void setSeriesMarkerSize(size_t, float);
+	void setSeriesName(size_t, std::string);
+
 	void dataDeselected(DataSelectedEventArgs&);
 	void dataSelected(DataSelectedEventArgs&);
 
@@ -99,28 +148,162 @@ public:
 	void mouseDragged(ofMouseEventArgs&);
 
 protected:
-	std::vector<dataPt> data;			//!< Stores all data values
-	std::vector<ofVec2f> displayData;	//!< Same data, but in screen coordiantes (pixels)
+	std::vector<ofxPlotSeries> series;	//!< Data series; there is always at least one
+
+	dataPt dataMin;					//!< Minimum data values across all series
+	dataPt dataMax;					//!< Maximum data values across all series
 
 	std::string xlabel = "";		//!< Horizontal axis label
 	std::string ylabel = "";		//!< Vertical axis label
 	std::string title = "";			//!< Plot title
 
-	bool fillPlot = false;			//!< Whether or not to fill the plot area
+	bool bCoalesceInput = false;	//!< Whether or not pointer input is processed once per update() rather than per event
+	bool bHoverPending = false;		//!< Whether or not a mouse move is waiting to be processed
+	bool bDragPending = false;		//!< Whether or not a mouse drag is waiting to be processed
+	ofVec2f pendingHoverPt;			//!< Most recent unprocessed mouse move location, screen coordinates
+	ofVec2f pendingDragPt;			//!< Most recent unprocessed mouse drag location, screen coordinates
+
+	bool bGPUTransform = false;		//!< Whether or not the data transform is applied on the GPU
+	bool bDensityValid = false;		//!< Whether or not densityPix reflects the current data and transform
+
+	ofxPlotStyle plotStyle = ofxPlotStyle::LINE;	//!< How the data are rendered
 
-	ofColor lineColor = ofColor(125, 125, 255, 255);		//!< Color of plotted line
 	ofColor fillColor = ofColor(200, 200, 255, 0.9*255);	//!< Color of fill under plotted line
 	ofColor axesColor = ofColor(200, 200, 200, 0.9*255);	//!< Axes color
 	ofColor textColor = ofColor(200, 200, 200, 255);		//!< Axes label and title color
+	ofColor gridColor = ofColor(200, 200, 200, 0.15*255);	//!< Gridline color
 
-	std::vector<int> highlightPtIxs;						//!< Data points to highlight
+	std::shared_ptr<const ofxPlotRangeSet> highlightPtIxs;	//!< Data points to highlight; may be shared with other objects
+	ofxPlotRangeSet visibleHighlights;		//!< Highlighted points that exist in the data
+	size_t highlightExtent = 0;				//!< Number of indices visibleHighlights was computed over
+	ofVboMesh highlightMesh;				//!< Rings around the visible highlighted points, screen coordinates
+	bool bHighlightMeshValid = false;		//!< Whether or not highlightMesh reflects the highlights and transform
+	size_t highlightSeries = 0;								//!< Series that the cross hairs and data value describe
 
 	float axesWidth = 3;			//!< Axes line width
-	float lineWidth = 2;			//!< Plotted data line width
+	float tickLength = 5;			//!< Length of the tick marks on the axes, pixels
+	float tickSpacing = 75;			//!< Approximate distance between ticks, pixels
 	float maxSelectDist = 10;		//!< Farthest the mouse can be from a data point and still select it
 	float padding = 25;				//!< Distance between outer rectangle and plot (i.e., with data) area
 
 	ofRectangle selectedArea = ofRectangle(0,0,0,0);		//!< Describes a rectangular selection area
+	ofRectangle plotArea = ofRectangle(0,0,0,0);			//!< Area within the axes padding, screen coordinates
+
+	double xScale = 1;				//!< Horizontal scaling, pixels per data unit
+	double yScale = 1;				//!< Vertical scaling, pixels per data unit
+	ofVec2f dataOrigin;				//!< Location of the data origin, (0,0), in screen coordinates
 	
 	ofxPlotArrow indAxis, depAxis;	//!< Axes arrows
+
+	/**
+	 *  @brief A tick mark on one of the axes
+	 */
+	struct Tick{
+		float pos = 0;				//!< Location along the axis, screen coordinates: x on the horizontal axis, y on the vertical axis
+		std::string label = "";		//!< Value at the tick, formatted
+	};
+
+	std::vector<Tick> xTicks;		//!< Ticks on the horizontal axis
+	std::vector<Tick> yTicks;		//!< Ticks on the vertical axis
+	ofVec2f tickDir;				//!< Side of each axis the ticks and their labels are on: x for the vertical axis, y for the horizontal axis (+/-1)
+	ofVboMesh gridMesh;				//!< Gridlines through the ticks, across the plot area, screen coordinates
+	ofVboMesh tickMesh;				//!< Tick marks, screen coordinates
+	bool bGridLines = true;			//!< Whether or not gridlines are drawn
+	bool bTicksValid = false;		//!< Whether or not the ticks, their labels, and the gridlines reflect the transform
+	bool bTicksHaveData = false;	//!< Whether or not the plot had data when the ticks were built; an empty plot has none
+	std::vector<ofVec2f> tickLabelPts;		//!< Text baseline locations of the tick labels, xTicks then yTicks
+	const ofxPlotFont *tickLabelFont = nullptr;	//!< Font tickLabelPts was laid out with; nullptr for bitmap text
+	bool bTickLabelPtsValid = false;		//!< Whether or not tickLabelPts reflects the ticks and the font
+
+	std::string valueStr = "";		//!< Cross hairs point value; empty if there are no cross hairs
+	dataPt valueStrPt;				//!< Cross hairs point that valueStr describes
+
+	ofShader transformShader;		//!< Applies the data transform on the GPU
+	ofVbo dataVbo;					//!< Offset-relative data for all series, one block per series
+	ofVbo fillVbo;					//!< Data interleaved with baseline points for filling, one block per series
+	dataPt vboOffset;				//!< Value subtracted from the data before upload to preserve float precision
+	size_t vboCapacity = 0;			//!< Total number of points the VBOs can hold, summed over all blocks
+	bool bShaderFailed = false;		//!< Whether or not the transform shader failed to load
+
+	bool bPtAttribsDirty = false;		//!< Whether or not the per-point attributes must be re-uploaded
+	ofShader scatterShader;				//!< Draws point sprite markers (scatter style only)
+	bool bScatterShaderFailed = false;	//!< Whether or not the scatter shader failed to load
+
+	ofxPlotDensityGrid densityGrid;	//!< Per-pixel point counts (density style only)
+	ofPixels densityPix;			//!< Color-mapped density grid, waiting to be uploaded (density style only)
+	ofTexture densityTex;			//!< Color-mapped density grid (density style only)
+	bool bDensityTexStale = false;	//!< Whether or not densityPix must be uploaded to densityTex
+
+	bool bAsyncGeometry = false;	//!< Whether or not the line geometry is built on a background thread
+	uint64_t dataVersion = 0;		//!< Incremented each time the data change; identifies data snapshots
+	std::future<std::shared_ptr<const ofxPlotGeometry> > pendingGeometry;	//!< Geometry being built in the background, if any
+	std::shared_ptr<const ofxPlotGeometry> frontGeometry;	//!< Most recently completed geometry, which is drawn
+	std::vector<ofVboMesh> asyncLineMeshes;	//!< Line strips of frontGeometry, one per series
+	std::vector<ofVboMesh> asyncFillMeshes;	//!< Fill strips of frontGeometry, one per series
+	bool bAsyncMeshStale = false;	//!< Whether or not the meshes must be rebuilt from frontGeometry
+
+	std::shared_ptr<ofxPlotScheduler> scheduler;	//!< Budget for progressive refinement; nullptr to draw all data each frame
+	bool bRefinementStale = true;	//!< Whether or not the refinement must restart with the current transform
+	bool bRefinementPending = false;	//!< Whether or not some data were left unrefined by the last refinement
+	uint64_t refinementMeshVersion = 0;	//!< Value of dataVersion when the refinement meshes were built
+	double refineNsPerPt = 20;		//!< Measured cost of refining one data point, nanoseconds
+
+	size_t memoryCap = 0;			//!< Most memory the plot may hold, bytes; zero for no cap
+	ofxPlotMemoryPolicy memoryPolicy = ofxPlotMemoryPolicy::EVICT_OLDEST;	//!< How the data are reduced when the cap is exceeded
+	uint64_t capVersion = 0;		//!< Value of dataVersion when the cap last removed points; older geometry has stale indices
+
+	bool bDataBatched = false;		//!< Whether or not the last addToBatch() call added the data to the batch
+
+	/**
+	 *  @brief Text baseline locations of the plot labels, screen coordinates
+	 */
+	struct Labels{
+		ofVec2f title;				//!< Title location
+		ofVec2f xlabel;				//!< Horizontal axis label location
+		ofVec2f ylabel;				//!< Vertical axis label location, in a frame rotated by -90 degrees
+		ofVec2f value;				//!< Location of the cross hairs point value
+	};
+
+	void applyMemoryCap();
+	void applySelection(DataSelectedEventArgs&);
+	void buildHighlightMesh();
+	void buildRefinementMeshes();
+	void buildTicks();
+	ofVec2f dataToScreen(const dataPt&) const;
+	void drawAxes(ofxPlotBatch*);
+	void drawBatched(ofVbo&, int, int, const ofShader&, bool);
+	void drawData();
+	void drawDataAsync();
+	void drawDataCPU();
+	void drawDataDensity();
+	void drawDataGPU();
+	void drawDataProgressive();
+	void drawDataScatter();
+	void drawHighlights(ofxPlotBatch*);
+	void drawLabels(ofxPlotBatch*);
+	void flushPendingInput();
+	void forEachBuffer(const std::function<void(size_t, const char*, size_t, bool)>&) const;
+	const dataPt* getCrossHairPt() const;
+	size_t getDataMemoryUsage() const;
+	size_t getIndexExtent() const;
+	bool getIndexedCandidates(size_t, const ofRectangle&, std::vector<size_t>&) const;
+	void getLabels(Labels&, const std::function<ofRectangle(const std::string&)>&) const;
+	static double getNiceStep(double, double);
+	void getTickLabelPts(std::vector<ofVec2f>&, const std::function<ofRectangle(const std::string&)>&) const;
+	bool hasData() const;
+	void invalidateGeometry();
+	bool isDataBatchable() const;
+	bool isValidSeries(size_t) const;
+	void processDrag(const ofVec2f&);
+	void processHover(const ofVec2f&);
+	void readSharedRings();
+	void refineLines();
+	void updateAsyncGeometry();
+	void updateDisplayData(ofxPlotSeries&);
+	void updateValueStr();
+	void updateVisibleHighlights();
+	void updateTransform();
+	void uploadData();
+	void uploadPointAttributes();
+	void uploadSpan(const ofxPlotSeries&, size_t, size_t);
 };
@@ -26,8 +26,28 @@
 
 #include "ofxPlotArrow.hpp"
 
+#include "ofxPlotBatch.hpp"
+#include "ofxPlotCanvas.hpp"
+
 #include "ofMain.h"
 
+/**
+ *  @brief Add an arrow to a batch rather than drawing it immediately
+ * 
+ *  @param batch batch to add the stem and point to
+ *  @param origin Origin point of the arrow, global pixel coordinates
+ *  @param end Tip of the arrow, global pixel coordinates
+ *  @param arrowSize size of the arrow, projected onto the arrow stem, pixels
+ *  @see draw()
+ */
+void ofxPlotArrow::addToBatch(ofxPlotBatch &batch, ofVec2f origin, ofVec2f end, float arrowSize) const{
+	ofVec2f stemEnd, cornerF, cornerB;
+	getPoints(origin, end, arrowSize, stemEnd, cornerF, cornerB);
+
+	batch.addLine(origin, stemEnd, color, lineWidth);
+	batch.addTriangle(end, cornerF, cornerB, color);
+}//====================================================
+
 /**
  *  @brief Draw an arrow
  * 
@@ -36,6 +56,66 @@
  *  @param arrowSize size of the arrow, projected onto the arrow stem, pixels
  */
 void ofxPlotArrow::draw(ofVec2f origin, ofVec2f end, float arrowSize){
+	ofVec2f stemEnd, cornerF, cornerB;
+	getPoints(origin, end, arrowSize, stemEnd, cornerF, cornerB);
+
+	ofPushStyle();
+
+	// Draw Stem
+	ofPolyline stem;
+	stem.addVertex(origin);
+	stem.addVertex(stemEnd);
+
+	ofSetLineWidth(lineWidth);
+	ofSetColor(color);
+	stem.draw();
+
+	ofPath arrow;
+	arrow.moveTo(end);
+	arrow.lineTo(cornerF);
+	arrow.lineTo(cornerB);
+	arrow.lineTo(end);
+
+	arrow.setColor(color);
+	arrow.draw();
+
+	ofPopStyle();
+}//====================================================
+
+/**
+ *  @brief Draw an arrow to a canvas, without OpenGL
+ * 
+ *  @param canvas canvas to draw the stem and point to
+ *  @param origin Origin point of the arrow, global pixel coordinates
+ *  @param end Tip of the arrow, global pixel coordinates
+ *  @param arrowSize size of the arrow, projected onto the arrow stem, pixels
+ *  @see draw()
+ */
+void ofxPlotArrow::drawTo(ofxPlotCanvas &canvas, ofVec2f origin, ofVec2f end, float arrowSize) const{
+	ofVec2f stemEnd, cornerF, cornerB;
+	getPoints(origin, end, arrowSize, stemEnd, cornerF, cornerB);
+
+	canvas.drawLine(origin, stemEnd, color, lineWidth);
+
+	std::vector<ofVec3f> point;
+	point.push_back(end);
+	point.push_back(cornerF);
+	point.push_back(cornerB);
+	canvas.fillPolygon(point, color);
+}//====================================================
+
+/**
+ *  @brief Compute the points that define an arrow
+ * 
+ *  @param origin Origin point of the arrow, global pixel coordinates
+ *  @param end Tip of the arrow, global pixel coordinates
+ *  @param arrowSize size of the arrow, projected onto the arrow stem, pixels
+ *  @param stemEnd set to the end of the stem, which stops inside the arrow point
+ *  @param cornerF set to the forward corner of the arrow point
+ *  @param cornerB set to the backward corner of the arrow point
+ */
+void ofxPlotArrow::getPoints(ofVec2f origin, ofVec2f end, float arrowSize, ofVec2f &stemEnd,
+	ofVec2f &cornerF, ofVec2f &cornerB) const{
 
 	// Determine arrow orientation
 	float angle = 0;
@@ -61,27 +141,9 @@ void ofxPlotArrow::draw(ofVec2f origin, ofVec2f end, float arrowSize){
 	// arrowPt_stem is a vector along the arrow stem that spans the length of the arrow point
 	ofVec2f arrowPt_stem(pointLen*cos(angle), pointLen*sin(angle));
 
-	ofPushStyle();
-
-	// Draw Stem
-	ofPolyline stem;
-	stem.addVertex(origin);
-	stem.addVertex(end - 0.75*arrowPt_stem);
-
-	ofSetLineWidth(lineWidth);
-	ofSetColor(color);
-	stem.draw();
-
-	ofPath arrow;
-	arrow.moveTo(end);
-	arrow.lineTo(end + arrowPtF);
-	arrow.lineTo(end + arrowPtB);
-	arrow.lineTo(end);
-
-	arrow.setColor(color);
-	arrow.draw();
-
-	ofPopStyle();
+	stemEnd = end - 0.75*arrowPt_stem;
+	cornerF = end + arrowPtF;
+	cornerB = end + arrowPtB;
 }//====================================================
 
 
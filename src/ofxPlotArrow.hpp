@@ -28,10 +28,16 @@
 
 #include "ofColor.h"
 
+// Forward declarations
+class ofxPlotBatch;
+class ofxPlotCanvas;
+
 class ofxPlotArrow{
 public:
 
+	void addToBatch(ofxPlotBatch&, ofVec2f, ofVec2f, float) const;
 	void draw(ofVec2f, ofVec2f, float);
+	void drawTo(ofxPlotCanvas&, ofVec2f, ofVec2f, float) const;
 	void setArrowSpread(float);
 	void setColor(ofColor);
 	void setLineWidth(float);
@@ -40,4 +46,6 @@ protected:
 	float arrowSpread = PI/6;
 	float lineWidth = 3;
 	ofColor color = ofColor(0,0,0);
+
+	void getPoints(ofVec2f, ofVec2f, float, ofVec2f&, ofVec2f&, ofVec2f&) const;
 };
\ No newline at end of file
@@ -0,0 +1,316 @@
+/**
+ * @file ofxPlotBatch.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotBatch.hpp"
+
+#include "ofxPlotFont.hpp"
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an empty batch
+ */
+ofxPlotBatch::ofxPlotBatch(){
+	fills.setMode(OF_PRIMITIVE_TRIANGLES);
+	fills.setUsage(GL_STREAM_DRAW);
+}//====================================================
+
+/**
+ *  @brief Remove all shapes
+ *  @details Buffers keep their capacity so that rebuilding the batch each
+ *  frame does not allocate; meshes for line widths and fonts that are no
+ *  longer used are released
+ */
+void ofxPlotBatch::clear(){
+	fills.clear();
+
+	for(std::map<float, ofVboMesh>::iterator it = lines.begin(); it != lines.end();){
+		if(it->second.getNumVertices() == 0){
+			it = lines.erase(it);
+		}else{
+			it->second.clear();
+			++it;
+		}
+	}
+
+	for(std::map<const ofxPlotFont*, Text>::iterator it = text.begin(); it != text.end();){
+		if(it->second.mesh.getNumVertices() == 0){
+			it = text.erase(it);
+		}else{
+			it->second.mesh.clear();
+			++it;
+		}
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Add Shapes --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add a line segment
+ * 
+ *  @param a first end point, screen coordinates
+ *  @param b second end point, screen coordinates
+ *  @param color line color
+ *  @param width line width, pixels
+ */
+void ofxPlotBatch::addLine(const ofVec2f &a, const ofVec2f &b, const ofColor &color, float width){
+	ofVboMesh &mesh = getLineMesh(width);
+	ofFloatColor c(color);
+	mesh.addVertex(ofVec3f(a.x, a.y, 0));
+	mesh.addVertex(ofVec3f(b.x, b.y, 0));
+	mesh.addColor(c);
+	mesh.addColor(c);
+}//====================================================
+
+/**
+ *  @brief Add a set of line segments
+ * 
+ *  @param pts pairs of segment end points, screen coordinates
+ *  @param color line color
+ *  @param width line width, pixels
+ */
+void ofxPlotBatch::addLines(const std::vector<ofVec3f> &pts, const ofColor &color, float width){
+	if(pts.size() < 2)
+		return;
+
+	ofVboMesh &mesh = getLineMesh(width);
+	size_t n = pts.size() - pts.size() % 2;
+	mesh.getVertices().insert(mesh.getVertices().end(), pts.begin(), pts.begin() + n);
+	mesh.getColors().insert(mesh.getColors().end(), n, ofFloatColor(color));
+}//====================================================
+
+/**
+ *  @brief Add a connected line
+ *  @details The line is stored as separate segments so that it can share a
+ *  mesh with other lines
+ * 
+ *  @param pts vertices of the line, screen coordinates
+ *  @param color line color
+ *  @param width line width, pixels
+ */
+void ofxPlotBatch::addLineStrip(const std::vector<ofVec2f> &pts, const ofColor &color, float width){
+	if(pts.size() < 2)
+		return;
+
+	ofVboMesh &mesh = getLineMesh(width);
+	std::vector<ofVec3f> &verts = mesh.getVertices();
+	verts.reserve(verts.size() + 2*(pts.size() - 1));
+	for(size_t i = 1; i < pts.size(); i++){
+		verts.push_back(ofVec3f(pts[i - 1].x, pts[i - 1].y, 0));
+		verts.push_back(ofVec3f(pts[i].x, pts[i].y, 0));
+	}
+	mesh.getColors().insert(mesh.getColors().end(), 2*(pts.size() - 1), ofFloatColor(color));
+}//====================================================
+
+/**
+ *  @brief Add a connected line
+ *  @see addLineStrip(const std::vector<ofVec2f>&, const ofColor&, float)
+ * 
+ *  @param pts vertices of the line, screen coordinates
+ *  @param color line color
+ *  @param width line width, pixels
+ */
+void ofxPlotBatch::addLineStrip(const std::vector<ofVec3f> &pts, const ofColor &color, float width){
+	if(pts.size() < 2)
+		return;
+
+	ofVboMesh &mesh = getLineMesh(width);
+	std::vector<ofVec3f> &verts = mesh.getVertices();
+	verts.reserve(verts.size() + 2*(pts.size() - 1));
+	for(size_t i = 1; i < pts.size(); i++){
+		verts.push_back(pts[i - 1]);
+		verts.push_back(pts[i]);
+	}
+	mesh.getColors().insert(mesh.getColors().end(), 2*(pts.size() - 1), ofFloatColor(color));
+}//====================================================
+
+/**
+ *  @brief Add a filled rectangle
+ * 
+ *  @param r rectangle, screen coordinates
+ *  @param color fill color
+ */
+void ofxPlotBatch::addRect(const ofRectangle &r, const ofColor &color){
+	ofVec2f tl(r.x, r.y), tr(r.x + r.width, r.y), br(r.x + r.width, r.y + r.height), bl(r.x, r.y + r.height);
+	addTriangle(tl, tr, br, color);
+	addTriangle(tl, br, bl, color);
+}//====================================================
+
+/**
+ *  @brief Add the outline of a rectangle
+ * 
+ *  @param r rectangle, screen coordinates
+ *  @param color line color
+ *  @param width line width, pixels
+ */
+void ofxPlotBatch::addRectOutline(const ofRectangle &r, const ofColor &color, float width){
+	ofVec2f tl(r.x, r.y), tr(r.x + r.width, r.y), br(r.x + r.width, r.y + r.height), bl(r.x, r.y + r.height);
+	addLine(tl, tr, color, width);
+	addLine(tr, br, color, width);
+	addLine(br, bl, color, width);
+	addLine(bl, tl, color, width);
+}//====================================================
+
+/**
+ *  @brief Add a string
+ *  @details The glyph quads are placed as ofTrueTypeFont::drawString() would
+ *  place them; a rotated string is drawn as if ofRotate(-90) had been applied
+ *  first, i.e., (x, y) are in the rotated frame and the text reads upward
+ * 
+ *  @param font font to draw with; must be loaded
+ *  @param str string
+ *  @param x horizontal location of the string's origin, pixels
+ *  @param y vertical location of the string's baseline, pixels
+ *  @param color text color
+ *  @param rotated whether or not to rotate the string 90 degrees counter-clockwise
+ */
+void ofxPlotBatch::addText(const std::shared_ptr<ofxPlotFont> &font, const std::string &str, float x, float y,
+	const ofColor &color, bool rotated){
+
+	if(!font || !font->isLoaded() || str.empty())
+		return;
+
+	Text &t = text[font.get()];
+	if(!t.font){
+		t.font = font;
+		t.mesh.setMode(OF_PRIMITIVE_TRIANGLES);
+		t.mesh.setUsage(GL_STREAM_DRAW);
+	}
+
+	ofMesh glyphs = font->getFont().getStringMesh(str, x, y);
+	const std::vector<ofVec3f> &verts = glyphs.getVertices();
+	const std::vector<ofVec2f> &uvs = glyphs.getTexCoords();
+	const std::vector<ofIndexType> &ixs = glyphs.getIndices();
+
+	// Glyph meshes may be indexed; expand them so that all strings share one unindexed mesh
+	size_t n = ixs.empty() ? verts.size() : ixs.size();
+	for(size_t i = 0; i < n; i++){
+		size_t v = ixs.empty() ? i : ixs[i];
+		ofVec3f pt = verts[v];
+		t.mesh.addVertex(rotated ? ofVec3f(pt.y, -pt.x, 0) : pt);
+		t.mesh.addTexCoord(uvs[v]);
+	}
+	t.mesh.getColors().insert(t.mesh.getColors().end(), n, ofFloatColor(color));
+}//====================================================
+
+/**
+ *  @brief Add a filled triangle
+ * 
+ *  @param a first corner, screen coordinates
+ *  @param b second corner, screen coordinates
+ *  @param c third corner, screen coordinates
+ *  @param color fill color
+ */
+void ofxPlotBatch::addTriangle(const ofVec2f &a, const ofVec2f &b, const ofVec2f &c, const ofColor &color){
+	ofFloatColor fc(color);
+	fills.addVertex(ofVec3f(a.x, a.y, 0));
+	fills.addVertex(ofVec3f(b.x, b.y, 0));
+	fills.addVertex(ofVec3f(c.x, c.y, 0));
+	fills.addColor(fc);
+	fills.addColor(fc);
+	fills.addColor(fc);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Draw --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Draw the filled shapes with a single draw call
+ */
+void ofxPlotBatch::drawFills() const{
+	if(fills.getNumVertices() > 0)
+		fills.draw();
+}//====================================================
+
+/**
+ *  @brief Draw the line segments with one draw call per line width
+ *  @details The line width is left at 1
+ */
+void ofxPlotBatch::drawLines() const{
+	for(std::map<float, ofVboMesh>::const_iterator it = lines.begin(); it != lines.end(); ++it){
+		if(it->second.getNumVertices() == 0)
+			continue;
+
+		ofSetLineWidth(it->first);
+		it->second.draw();
+	}
+	ofSetLineWidth(1);
+}//====================================================
+
+/**
+ *  @brief Draw the text with one draw call per font
+ */
+void ofxPlotBatch::drawText() const{
+	for(std::map<const ofxPlotFont*, Text>::const_iterator it = text.begin(); it != text.end(); ++it){
+		if(it->second.mesh.getNumVertices() == 0)
+			continue;
+
+		const ofTexture &atlas = it->second.font->getFont().getFontTexture();
+		atlas.bind();
+		it->second.mesh.draw();
+		atlas.unbind();
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the number of draw calls the batch needs
+ *  @return the number of non-empty meshes
+ */
+size_t ofxPlotBatch::getNumDrawCalls() const{
+	size_t n = fills.getNumVertices() > 0 ? 1 : 0;
+	for(std::map<float, ofVboMesh>::const_iterator it = lines.begin(); it != lines.end(); ++it){
+		n += it->second.getNumVertices() > 0 ? 1 : 0;
+	}
+	for(std::map<const ofxPlotFont*, Text>::const_iterator it = text.begin(); it != text.end(); ++it){
+		n += it->second.mesh.getNumVertices() > 0 ? 1 : 0;
+	}
+	return n;
+}//====================================================
+
+/**
+ *  @brief Retrieve the mesh that holds line segments of a given width
+ *  @param width line width, pixels
+ *  @return the mesh, created if necessary
+ */
+ofVboMesh& ofxPlotBatch::getLineMesh(float width){
+	std::map<float, ofVboMesh>::iterator it = lines.find(width);
+	if(it == lines.end()){
+		it = lines.insert(std::make_pair(width, ofVboMesh())).first;
+		it->second.setMode(OF_PRIMITIVE_LINES);
+		it->second.setUsage(GL_STREAM_DRAW);
+	}
+	return it->second;
+}//====================================================
@@ -0,0 +1,86 @@
+/**
+ * @file ofxPlotBatch.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations
+class ofxPlotFont;
+
+/**
+ *  @brief Collects the simple geometry of many widgets so that it can be
+ *  drawn with a handful of draw calls
+ *  @details Widgets add filled shapes, line segments, and text in screen
+ *  coordinates, each with its own color. Everything is merged by kind: one
+ *  mesh of triangles, one mesh of line segments per line width, and one
+ *  mesh of glyph quads per font, so the number of draw calls depends on the
+ *  number of distinct line widths and fonts rather than on the number of
+ *  widgets. Shapes of the same kind are drawn in the order they were added.
+ *  @see InteractiveObj::addToBatch(), ofxPlotContainer::setBatched()
+ */
+class ofxPlotBatch{
+public:
+	ofxPlotBatch();
+
+	void clear();
+
+	void addLine(const ofVec2f&, const ofVec2f&, const ofColor&, float = 1);
+	void addLines(const std::vector<ofVec3f>&, const ofColor&, float = 1);
+	void addLineStrip(const std::vector<ofVec2f>&, const ofColor&, float = 1);
+	void addLineStrip(const std::vector<ofVec3f>&, const ofColor&, float = 1);
+	void addRect(const ofRectangle&, const ofColor&);
+	void addRectOutline(const ofRectangle&, const ofColor&, float = 1);
+	void addText(const std::shared_ptr<ofxPlotFont>&, const std::string&, float, float, const ofColor&, bool = false);
+	void addTriangle(const ofVec2f&, const ofVec2f&, const ofVec2f&, const ofColor&);
+
+	void drawFills() const;
+	void drawLines() const;
+	void drawText() const;
+
+	size_t getNumDrawCalls() const;
+
+protected:
+	ofVboMesh fills;					//!< Filled triangles, with per-vertex colors
+	std::map<float, ofVboMesh> lines;	//!< Line segments with per-vertex colors, one mesh per line width
+
+	/**
+	 *  @brief Glyph quads that share a font's atlas
+	 */
+	struct Text{
+		std::shared_ptr<ofxPlotFont> font;	//!< Font whose atlas the quads sample; held until the batch is cleared
+		ofVboMesh mesh;						//!< Glyph quads, with per-vertex colors
+	};
+	std::map<const ofxPlotFont*, Text> text;	//!< Text, one mesh per font
+
+	ofVboMesh& getLineMesh(float);
+};
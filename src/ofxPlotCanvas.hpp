@@ -0,0 +1,130 @@
+/**
+ * @file ofxPlotCanvas.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <string>
+#include <vector>
+
+/**
+ *  @brief A drawing surface that a plot can describe itself to without OpenGL
+ *  @details ofxPlot::drawTo() walks the plot's content (background, data,
+ *  axes, labels, highlights, and selection) and issues these calls, in
+ *  screen coordinates, between begin() and end(). Implementations turn the
+ *  calls into a file (ofxPlotSVG) or an image (ofxPlotRaster). Shapes are
+ *  alpha blended in the order they are issued.
+ */
+class ofxPlotCanvas{
+public:
+	virtual ~ofxPlotCanvas(){}
+
+	/**
+	 *  @brief Start a drawing that covers an area
+	 *  @param area area to draw, screen coordinates
+	 */
+	virtual void begin(const ofRectangle &area) = 0;
+
+	/**
+	 *  @brief Finish the drawing
+	 */
+	virtual void end() = 0;
+
+	/**
+	 *  @brief Draw the outline of a circle
+	 *  @param center center, screen coordinates
+	 *  @param radius radius, pixels
+	 *  @param color line color
+	 *  @param width line width, pixels
+	 */
+	virtual void drawCircle(const ofVec2f &center, float radius, const ofColor &color, float width) = 0;
+
+	/**
+	 *  @brief Draw a line segment
+	 *  @param a first end, screen coordinates
+	 *  @param b second end, screen coordinates
+	 *  @param color line color
+	 *  @param width line width, pixels
+	 */
+	virtual void drawLine(const ofVec2f &a, const ofVec2f &b, const ofColor &color, float width) = 0;
+
+	/**
+	 *  @brief Draw a line through a sequence of points
+	 *  @param pts points, screen coordinates
+	 *  @param color line color
+	 *  @param width line width, pixels
+	 */
+	virtual void drawLineStrip(const std::vector<ofVec3f> &pts, const ofColor &color, float width) = 0;
+
+	/**
+	 *  @brief Draw a string
+	 *  @param str text
+	 *  @param x horizontal location of the baseline start
+	 *  @param y vertical location of the baseline
+	 *  @param color text color
+	 *  @param rotated whether (x, y) are in a frame rotated by -90 degrees,
+	 *  i.e., the text reads from bottom to top at screen location (y, -x)
+	 */
+	virtual void drawText(const std::string &str, float x, float y, const ofColor &color, bool rotated) = 0;
+
+	/**
+	 *  @brief Fill a circle
+	 *  @param center center, screen coordinates
+	 *  @param radius radius, pixels
+	 *  @param color fill color
+	 */
+	virtual void fillCircle(const ofVec2f &center, float radius, const ofColor &color) = 0;
+
+	/**
+	 *  @brief Fill a closed polygon with the nonzero winding rule
+	 *  @param pts vertices, screen coordinates; the last connects to the first
+	 *  @param color fill color
+	 */
+	virtual void fillPolygon(const std::vector<ofVec3f> &pts, const ofColor &color) = 0;
+
+	/**
+	 *  @brief Fill a rectangle
+	 *  @param r rectangle, screen coordinates
+	 *  @param color fill color
+	 */
+	virtual void fillRect(const ofRectangle &r, const ofColor &color) = 0;
+
+	/**
+	 *  @brief Measure a string, as drawn at (0, 0)
+	 *  @param str text
+	 *  @return the bounding box, or an empty rectangle if hasFont() is false
+	 */
+	virtual ofRectangle getStringBoundingBox(const std::string &str) const = 0;
+
+	/**
+	 *  @brief Determine whether text is drawn with a scalable font
+	 *  @details Without one, text is laid out for the 8x13 bitmap font
+	 *  @return whether or not the canvas has a font
+	 */
+	virtual bool hasFont() const = 0;
+};
@@ -0,0 +1,220 @@
+/**
+ * @file ofxPlotContainer.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotContainer.hpp"
+
+#include "interactiveObj.hpp"
+#include "ofxPlotThreadPool.hpp"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an empty container that uses the shared thread pool
+ */
+ofxPlotContainer::ofxPlotContainer(){
+	pool = ofxPlotThreadPool::getShared();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Graphics & Event Loop --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Draw all objects, in the order they were added
+ *  @details Call this from the render thread
+ */
+void ofxPlotContainer::draw(){
+	if(bBatched){
+		drawBatch();
+		return;
+	}
+
+	for(size_t i = 0; i < objects.size(); i++){
+		if(bDrawCached)
+			objects[i]->drawCached();
+		else
+			objects[i]->draw();
+	}
+}//====================================================
+
+/**
+ *  @brief Draw all objects through the batch
+ *  @details The batch is drawn in layers: the fills (e.g., backgrounds) of
+ *  every object, then whatever each object could not batch, then the lines
+ *  and text of every object. Objects that do not support batching are drawn
+ *  normally in the middle layer. Objects should not overlap, since the
+ *  layers of one object are no longer drawn on top of the layers of the
+ *  previous object. Caching with drawCached() does not apply.
+ */
+void ofxPlotContainer::drawBatch(){
+	batch.clear();
+	inBatch.assign(objects.size(), false);
+	for(size_t i = 0; i < objects.size(); i++){
+		inBatch[i] = objects[i]->addToBatch(batch);
+	}
+
+	ofPushStyle();
+	ofDisableDepthTest();
+	batch.drawFills();
+	ofEnableDepthTest();
+	ofPopStyle();
+
+	for(size_t i = 0; i < objects.size(); i++){
+		if(inBatch[i])
+			objects[i]->drawUnbatched();
+		else
+			objects[i]->draw();
+	}
+
+	ofPushStyle();
+	ofDisableDepthTest();
+	batch.drawLines();
+	batch.drawText();
+	ofEnableDepthTest();
+	ofPopStyle();
+}//====================================================
+
+/**
+ *  @brief Update all objects serially, then prepare them in parallel
+ *  @details When this function returns, every object has been prepared, so
+ *  draw() only performs OpenGL work
+ */
+void ofxPlotContainer::update(){
+	for(size_t i = 0; i < objects.size(); i++){
+		objects[i]->update();
+	}
+
+	if(bParallel && pool && objects.size() > 1){
+		pool->parallelFor(objects.size(), [this](size_t i){
+			objects[i]->prepare();
+		});
+	}else{
+		for(size_t i = 0; i < objects.size(); i++){
+			objects[i]->prepare();
+		}
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add an object to the container
+ *  @param obj pointer to the object; ignored if it is already in the container
+ */
+void ofxPlotContainer::add(InteractiveObj *obj){
+	if(obj && std::find(objects.begin(), objects.end(), obj) == objects.end())
+		objects.push_back(obj);
+}//====================================================
+
+/**
+ *  @brief Remove an object from the container
+ *  @param obj pointer to the object
+ */
+void ofxPlotContainer::remove(InteractiveObj *obj){
+	objects.erase(std::remove(objects.begin(), objects.end(), obj), objects.end());
+}//====================================================
+
+/**
+ *  @brief Remove all objects from the container
+ */
+void ofxPlotContainer::clear(){ objects.clear(); }
+
+/**
+ *  @brief Retrieve the batch built by the most recent draw
+ *  @details Use ofxPlotBatch::getNumDrawCalls() to see how many draw calls
+ *  the batched objects cost
+ *  @return the batch; it is empty unless batching is enabled
+ */
+const ofxPlotBatch& ofxPlotContainer::getBatch() const { return batch; }
+
+/**
+ *  @brief Retrieve the bytes held by every object in the container
+ *  @details Each buffer is prefixed with the index of the object that holds
+ *  it, e.g., "2: series 0 data"
+ *  @return the buffers held by the objects
+ */
+ofxPlotMemory ofxPlotContainer::getMemoryUsage() const{
+	ofxPlotMemory mem;
+	for(size_t i = 0; i < objects.size(); i++){
+		mem.add(ofToString(i) + ": ", objects[i]->getMemoryUsage());
+	}
+	return mem;
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of objects in the container
+ *  @return the number of objects in the container
+ */
+size_t ofxPlotContainer::getNumObjects() const { return objects.size(); }
+
+/**
+ *  @brief Retrieve an object from the container
+ *  @param ix index of the object, in the order they were added
+ *  @return pointer to the object, or nullptr if the index is out of range
+ */
+InteractiveObj* ofxPlotContainer::getObject(size_t ix) const{
+	return ix < objects.size() ? objects[ix] : nullptr;
+}//====================================================
+
+/**
+ *  @brief Tell the container whether to merge the objects into one batch
+ *  @details When enabled, draw() collects the simple geometry of every object
+ *  that supports batching (see InteractiveObj::addToBatch()) and draws it
+ *  with a few draw calls. This replaces drawing from the caches.
+ *  @param batched whether or not to batch the objects
+ */
+void ofxPlotContainer::setBatched(bool batched){
+	bBatched = batched;
+	if(!bBatched)
+		batch.clear();
+}//====================================================
+
+/**
+ *  @brief Tell the container whether to draw the objects from their caches
+ *  @param cached whether or not to draw with InteractiveObj::drawCached()
+ */
+void ofxPlotContainer::setDrawCached(bool cached){ bDrawCached = cached; }
+
+/**
+ *  @brief Tell the container whether to prepare the objects in parallel
+ *  @details Disable this to debug an object's prepare() on a single thread
+ *  @param parallel whether or not to prepare the objects in parallel
+ */
+void ofxPlotContainer::setParallel(bool parallel){ bParallel = parallel; }
+
+/**
+ *  @brief Set the thread pool that runs the prepare phase
+ *  @param p pointer to the pool; nullptr uses the shared pool
+ */
+void ofxPlotContainer::setThreadPool(std::shared_ptr<ofxPlotThreadPool> p){
+	pool = p ? p : ofxPlotThreadPool::getShared();
+}//====================================================
@@ -0,0 +1,92 @@
+/**
+ * @file ofxPlotContainer.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "ofxPlotBatch.hpp"
+#include "ofxPlotMemory.hpp"
+
+#include "ofMain.h"
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+class InteractiveObj;
+class ofxPlotThreadPool;
+
+/**
+ *  @brief Updates and draws a collection of objects, preparing them in parallel
+ *  @details Each frame is split into three phases:
+ *  1. update(), serially on the calling thread, in the order the objects were
+ *  added. Input processing, events, and changes that touch other objects
+ *  (e.g., a control moving its limiters) belong here.
+ *  2. prepare(), in parallel on a thread pool. Each object may only touch its
+ *  own state and must not make OpenGL calls or send events; see
+ *  InteractiveObj::prepare(). Do not modify the objects from other threads
+ *  during this phase.
+ *  3. draw(), serially on the render thread, where all OpenGL work happens.
+ *  When batching is enabled (see setBatched()), the objects' backgrounds,
+ *  lines, and text are merged into one ofxPlotBatch and drawn with a few
+ *  draw calls instead of several per object.
+ * 
+ *  The container does not own the objects; they must remain in scope until
+ *  they are removed or the container is destroyed.
+ */
+class ofxPlotContainer{
+public:
+	ofxPlotContainer();
+
+	void add(InteractiveObj*);
+	void remove(InteractiveObj*);
+	void clear();
+
+	void draw();
+	void update();
+
+	const ofxPlotBatch& getBatch() const;
+	ofxPlotMemory getMemoryUsage() const;
+	size_t getNumObjects() const;
+	InteractiveObj* getObject(size_t) const;
+
+	void setBatched(bool);
+	void setDrawCached(bool);
+	void setParallel(bool);
+	void setThreadPool(std::shared_ptr<ofxPlotThreadPool>);
+
+protected:
+	std::vector<InteractiveObj*> objects;			//!< Objects in the order they are updated and drawn
+	std::shared_ptr<ofxPlotThreadPool> pool;		//!< Pool that runs the prepare phase
+
+	bool bBatched = false;			//!< Whether or not to merge the objects' simple geometry into one batch
+	bool bDrawCached = false;		//!< Whether or not to draw the objects with InteractiveObj::drawCached()
+	bool bParallel = true;			//!< Whether or not to prepare the objects in parallel
+
+	ofxPlotBatch batch;				//!< Merged geometry of the batched objects, rebuilt each draw
+	std::vector<bool> inBatch;		//!< Whether or not each object was added to the batch in the last draw
+
+	void drawBatch();
+};
@@ -27,11 +27,20 @@ void ofxPlotCtrl::init(){
 //-----------------------------------------------------------------------------
 
 void ofxPlotCtrl::update(){
-	timelineRect.setPosition(viewport.x + 15, viewport.y + 20);
-	timelineRect.setSize(viewport.width - 2*15, viewport.height - 2*20);
+	ofRectangle timeline(viewport.x + 15, viewport.y + 20, viewport.width - 2*15, viewport.height - 2*20);
+	if(timeline != timelineRect){
+		timelineRect = timeline;
+		bHighlightMeshValid = false;
+		requestRedraw();
+	}
 
 	if(indVars.size() > 1 && link_limitValLower && link_limitValUpper){
-		scale = std::abs( timelineRect.width/(indVars.back() - indVars.front()) );
+		float s = std::abs( timelineRect.width/(indVars.back() - indVars.front()) );
+		if(s != scale){
+			scale = s;
+			bHighlightMeshValid = false;
+			requestRedraw();
+		}
 		
 		// If the user is not dragging the limit marker, update the position in case the size
 		// of the timeline widget has changed; else, update the limit time variable
@@ -59,19 +68,37 @@ void ofxPlotCtrl::update(){
 	limitUpper.update();
 }//====================================================
 
+/**
+ *  @brief Prepare the control to be drawn
+ *  @details Builds the highlight geometry if the highlights, the data, or
+ *  the timeline have changed. No OpenGL calls are made, so this may run on
+ *  a worker thread.
+ *  @see InteractiveObj::prepare()
+ */
+void ofxPlotCtrl::prepare(){
+	OFXPLOT_SET(stats, ofxPlotStats::PTS_STORED, indVars.size());
+	if(indVars.size() != highlightExtent)
+		updateVisibleHighlights();
+
+	if(indVars.size() > 1 && !visibleHighlights.empty() && !bHighlightMeshValid){
+		OFXPLOT_TIME(stats, ofxPlotStats::MESH);
+		buildHighlightMesh();
+	}
+}//====================================================
+
 void ofxPlotCtrl::draw(){
+	prepare();
 	InteractiveObj::draw();
 
 	ofDisableDepthTest();
 	ofPushStyle();
 
 	// Draw highlighted points, if any
-	if(indVars.size() > 1){
+	if(indVars.size() > 1 && !visibleHighlights.empty()){
+		OFXPLOT_TIME(stats, ofxPlotStats::SUBMIT);
 		ofSetColor(ofColor::yellow);
-		for(size_t i = 0; i < highlightPtIxs.size(); i++){
-			float x = (indVars[highlightPtIxs[i]] - indVars[0])*scale + timelineRect.x;
-			ofDrawCircle(ofVec2f(x, timelineRect.y + 0.5*timelineRect.height), 2);
-		}
+		highlightMesh.draw();
+		OFXPLOT_COUNT(stats, ofxPlotStats::PTS_DRAWN, highlightMesh.getNumVertices());
 	}
 
 	// Get positions of sliders
@@ -104,17 +131,83 @@ void ofxPlotCtrl::draw(){
 
 	limitLower.draw();
 	limitUpper.draw();
+
+	drawStats();
 }//====================================================
 
 //-----------------------------------------------------------------------------
 // -- Set and Get Functions --
 //-----------------------------------------------------------------------------
 
-void ofxPlotCtrl::addDataPt(double val){ indVars.push_back(val); }
+/**
+ *  @brief Determine whether the control must be redrawn
+ *  @details The control draws its limiters, so it must be redrawn
+ *  whenever either of them changes
+ *  @return whether or not the appearance of the control or either
+ *  limiter has changed since it was last drawn
+ */
+bool ofxPlotCtrl::needsRedraw() const{
+	return InteractiveObj::needsRedraw() || limitLower.needsRedraw() || limitUpper.needsRedraw();
+}//====================================================
 
-void ofxPlotCtrl::setData(std::vector<double> vals){ indVars = vals; }
+/**
+ *  @brief Retrieve the bytes held by the control and its limiters, broken
+ *  down by buffer
+ *  @return the buffers held by the control
+ *  @see InteractiveObj::getMemoryUsage()
+ */
+ofxPlotMemory ofxPlotCtrl::getMemoryUsage() const{
+	ofxPlotMemory mem = InteractiveObj::getMemoryUsage();
+	mem.add("data", ofxPlotMemory::bytesOf(indVars));
+	if(highlightPtIxs)
+		mem.add("highlights (shared)", ofxPlotMemory::bytesOf(highlightPtIxs->getRanges()));
+	mem.add("visible highlights", ofxPlotMemory::bytesOf(visibleHighlights.getRanges()));
+	mem.add("highlight mesh", ofxPlotMemory::bytesOf(highlightMesh));
+	mem.add("highlight mesh", ofxPlotMemory::bytesOf(highlightMesh), true);
+	mem.add("lower limiter ", limitLower.getMemoryUsage());
+	mem.add("upper limiter ", limitUpper.getMemoryUsage());
+	return mem;
+}//====================================================
 
-void ofxPlotCtrl::setHighlightedPts(std::vector<int> pts){ highlightPtIxs = pts; }
+void ofxPlotCtrl::addDataPt(double val){ indVars.push_back(val); bHighlightMeshValid = false; requestRedraw(); }
+
+void ofxPlotCtrl::setData(std::vector<double> vals){ indVars = vals; bHighlightMeshValid = false; requestRedraw(); }
+
+/**
+ *  @brief Route the mouse events for this control and its limiters
+ *  through a dispatcher
+ *  @param d pointer to the dispatcher, or nullptr to listen to the
+ *  global mouse events directly
+ *  @see InteractiveObj::setDispatcher()
+ */
+void ofxPlotCtrl::setDispatcher(ofxPlotDispatcher *d){
+	InteractiveObj::setDispatcher(d);
+	limitLower.setDispatcher(d);
+	limitUpper.setDispatcher(d);
+}//====================================================
+
+void ofxPlotCtrl::setHighlightedPts(std::vector<int> pts){
+	std::shared_ptr<ofxPlotRangeSet> set = std::make_shared<ofxPlotRangeSet>();
+	for(size_t i = 0; i < pts.size(); i++){
+		if(pts[i] >= 0)
+			set->add(pts[i]);
+	}
+	setHighlightedPts(set);
+}//====================================================
+
+/**
+ *  @brief Set the data points to highlight without copying them
+ *  @param pts pointer to the indices of the points to highlight, which
+ *  must not be modified while the control holds them; nullptr to clear
+ *  the highlights
+ */
+void ofxPlotCtrl::setHighlightedPts(std::shared_ptr<const ofxPlotRangeSet> pts){
+	if(pts == highlightPtIxs)
+		return;
+
+	highlightPtIxs = pts;
+	updateVisibleHighlights();
+}//====================================================
 
 void ofxPlotCtrl::setLink_lowerLimit(float *ptr){ link_limitValLower = ptr; }
 
@@ -140,11 +233,87 @@ void ofxPlotCtrl::setLink_upperLimit(float *ptr){ link_limitValUpper = ptr; }
 // -- Event Handlers --
 //-----------------------------------------------------------------------------
 
+/**
+ *  @brief Handle data selection events
+ *  @details Events this control has already seen are ignored, and the
+ *  highlights are only updated if the change affects its data
+ *  @param args data structure containing information about the event
+ */
 void ofxPlotCtrl::dataSelected(DataSelectedEventArgs &args){
-	setHighlightedPts(args.indices);
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
+	if(!isNewSelection(args))
+		return;
+
+	highlightPtIxs = args.indices;
+
+	size_t n = indVars.size();
+	if(!args.added || !args.removed || n != highlightExtent ||
+		args.added->intersects(0, n) || args.removed->intersects(0, n)){
+
+		updateVisibleHighlights();
+	}
 }//====================================================
 
+/**
+ *  @brief Handle data deselection events
+ *  @param args data structure containing information about the event
+ *  @see dataSelected()
+ */
 void ofxPlotCtrl::dataDeselected(DataSelectedEventArgs &args){
-	std::vector<int> empty;
-	setHighlightedPts(empty);
-}//====================================================
\ No newline at end of file
+	dataSelected(args);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Highlights --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Build the markers drawn on the timeline for the visible
+ *  highlighted points
+ *  @details The markers are stored in a single mesh, which is only rebuilt
+ *  when the visible highlights, the data, or the timeline change
+ */
+void ofxPlotCtrl::buildHighlightMesh(){
+	const int segs = 8;
+	const float radius = 2;
+	ofVec3f disc[segs + 1];
+	for(int k = 0; k <= segs; k++){
+		disc[k] = ofVec3f(radius*cos(TWO_PI*k/segs), radius*sin(TWO_PI*k/segs), 0);
+	}
+
+	highlightMesh.clear();
+	highlightMesh.setMode(OF_PRIMITIVE_TRIANGLES);
+
+	const std::vector<ofxPlotRangeSet::range_t> &ranges = visibleHighlights.getRanges();
+	for(size_t r = 0; r < ranges.size(); r++){
+		for(size_t i = ranges[r].first; i < ranges[r].second; i++){
+			ofVec3f center((indVars[i] - indVars[0])*scale + timelineRect.x, timelineRect.y + 0.5*timelineRect.height, 0);
+			for(int k = 0; k < segs; k++){
+				highlightMesh.addVertex(center);
+				highlightMesh.addVertex(center + disc[k]);
+				highlightMesh.addVertex(center + disc[k + 1]);
+			}
+		}
+	}
+
+	bHighlightMeshValid = true;
+}//====================================================
+
+/**
+ *  @brief Update the set of highlighted points that exist in the data
+ *  @details Only the highlighted ranges within the data are visited. If the
+ *  visible highlights change, the highlight mesh is rebuilt on the next draw.
+ */
+void ofxPlotCtrl::updateVisibleHighlights(){
+	highlightExtent = indVars.size();
+
+	ofxPlotRangeSet visible;
+	if(highlightPtIxs)
+		highlightPtIxs->slice(0, highlightExtent, visible);
+
+	if(visible != visibleHighlights){
+		visibleHighlights.swap(visible);
+		bHighlightMeshValid = false;
+		requestRedraw();
+	}
+}//====================================================
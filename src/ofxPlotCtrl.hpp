@@ -2,6 +2,9 @@
 
 #include "interactiveObj.hpp"
 #include "ofxPlotCtrlLimiter.hpp"
+#include "ofxPlotRangeSet.hpp"
+
+#include <memory>
 
 class ofxPlotCtrl : public InteractiveObj{
 public:
@@ -9,13 +12,19 @@ public:
 	ofxPlotCtrl(float, float);
 
 	void update();
+	void prepare();
 	void draw();
 
+	ofxPlotMemory getMemoryUsage() const;
+	bool needsRedraw() const;
+
 	void addDataPt(double);
 
 	void setData(std::vector<double>);
+	void setDispatcher(ofxPlotDispatcher*);
 
 	void setHighlightedPts(std::vector<int>);
+	void setHighlightedPts(std::shared_ptr<const ofxPlotRangeSet>);
 
 	void setLink_lowerLimit(float*);
 	void setLink_upperLimit(float*);
@@ -27,7 +36,11 @@ public:
 	void dataSelected(DataSelectedEventArgs&);
 protected:
 	std::vector<double> indVars;		//!< vector of all the independent variable values
-	std::vector<int> highlightPtIxs;	//!< Data points to highlight
+	std::shared_ptr<const ofxPlotRangeSet> highlightPtIxs;	//!< Data points to highlight; may be shared with other objects
+	ofxPlotRangeSet visibleHighlights;		//!< Highlighted points that exist in the data
+	size_t highlightExtent = 0;				//!< Number of indices visibleHighlights was computed over
+	ofVboMesh highlightMesh;				//!< Markers on the timeline for the visible highlighted points
+	bool bHighlightMeshValid = false;		//!< Whether or not highlightMesh reflects the highlights and timeline
 
 	float limitValLower = 0;			//!< Lower limit on the independent variable, same units as independent variable
 	float limitValUpper = 1;			//!< Upper limit on the independent variable, same units as independent variable
@@ -43,5 +56,7 @@ protected:
 
 	ofxPlotCtrlLimiter limitLower, limitUpper;
 
+	void buildHighlightMesh();
 	void init();
+	void updateVisibleHighlights();
 };
\ No newline at end of file
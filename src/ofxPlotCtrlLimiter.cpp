@@ -23,7 +23,7 @@ void ofxPlotCtrlLimiter::init(){
 
 void ofxPlotCtrlLimiter::update(){
 	// Compute the width of the triangle using trig
-	viewport.width = (isUpper ? -1 : 1)*0.5*std::sqrt(3)*viewport.height;
+	setWidth((isUpper ? -1 : 1)*0.5*std::sqrt(3)*viewport.height);
 
 	// Set the X or Y bounds if the limiter's movement is constrained
 	if(moveLR)
@@ -35,6 +35,8 @@ void ofxPlotCtrlLimiter::update(){
 
 void ofxPlotCtrlLimiter::draw(){
 	// Do not call the base-class draw function; completely override it
+	bNeedsRedraw = false;
+
 	ofPath outline;
 	outline.moveTo(viewport.x, viewport.y);
 	outline.lineTo(viewport.x, viewport.y + viewport.height);
@@ -80,9 +82,9 @@ float ofxPlotCtrlLimiter::getLimiterCoord() const{
  */
 void ofxPlotCtrlLimiter::moveToLimiterCoord(float coord){
 	if(moveLR)
-		viewport.x = coord - viewport.width;
+		setX(coord - viewport.width);
 	else
-		viewport.y = coord - viewport.height;
+		setY(coord - viewport.height);
 }//====================================================
 
 /**
@@ -120,6 +122,7 @@ void ofxPlotCtrlLimiter::setYBounds(float min, float max){
  *  @param mouse contains information relevant to the mouse event
  */
 void ofxPlotCtrlLimiter::mouseDragged(ofMouseEventArgs &mouse){
+	OFXPLOT_TIME(stats, ofxPlotStats::EVENTS);
 	if(isMousePressedInside){
 		
 		if(moveLR && mouse.x >= bounds[0] && mouse.x <= bounds[1])
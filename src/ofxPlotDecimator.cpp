@@ -0,0 +1,156 @@
+/**
+ * @file ofxPlotDecimator.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotDecimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//-----------------------------------------------------------------------------
+// -- Decimate --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Discard all output and set the transform from data to screen
+ *  coordinates
+ * 
+ *  @param origin location of the data origin, screen coordinates
+ *  @param xs horizontal scaling, pixels per data unit
+ *  @param ys vertical scaling, pixels per data unit
+ */
+void ofxPlotDecimator::reset(const ofVec2f &origin, double xs, double ys){
+	dataOrigin = origin;
+	xScale = xs;
+	yScale = ys;
+	restart();
+}//====================================================
+
+/**
+ *  @brief Discard all output so that the data are decimated again from
+ *  the first point, with the same transform
+ */
+void ofxPlotDecimator::restart(){
+	line.clear();
+	bOpen = false;
+	count = 0;
+}//====================================================
+
+/**
+ *  @brief Consume the next span of points
+ *  @details Points are consumed from getCount() up to, but not including,
+ *  end; the data before getCount() must not have changed since they were
+ *  consumed
+ * 
+ *  @param data data points
+ *  @param end one past the index of the final point to consume
+ */
+void ofxPlotDecimator::add(const std::vector<dataPt> &data, size_t end){
+	end = std::min(end, data.size());
+	for(size_t i = count; i < end; i++){
+		Sample s;
+		s.ix = i;
+		s.pt = ofVec2f(dataOrigin.x + xScale*data[i].indVar, dataOrigin.y - yScale*data[i].depVar);
+		double c = std::floor(s.pt.x);
+
+		if(!bOpen || c != col){
+			if(bOpen)
+				emit(line);
+
+			first = lo = hi = last = s;
+			col = c;
+			bOpen = true;
+		}else{
+			if(s.pt.y < lo.pt.y)
+				lo = s;
+			else if(s.pt.y > hi.pt.y)
+				hi = s;
+
+			last = s;
+		}
+	}
+	count = std::max(count, end);
+}//====================================================
+
+/**
+ *  @brief Move the points of the current column into the line
+ *  @details Call this once all of the data have been consumed
+ */
+void ofxPlotDecimator::finish(){
+	if(bOpen)
+		emit(line);
+
+	bOpen = false;
+}//====================================================
+
+/**
+ *  @brief Append the retained points of the current column to a line, in
+ *  index order
+ *  @param out line to append to
+ */
+void ofxPlotDecimator::emit(std::vector<ofVec3f> &out) const{
+	Sample pts[4] = {first, lo, hi, last};
+	std::sort(pts, pts + 4, [](const Sample &a, const Sample &b){ return a.ix < b.ix; });
+	for(int k = 0; k < 4; k++){
+		if(k == 0 || pts[k].ix != pts[k - 1].ix)
+			out.push_back(ofVec3f(pts[k].pt.x, pts[k].pt.y, 0));
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the number of points consumed
+ *  @return the index of the next point to consume
+ */
+size_t ofxPlotDecimator::getCount() const { return count; }
+
+/**
+ *  @brief Retrieve the vertices of the completed columns
+ *  @details The points of the current column are not included until
+ *  finish() is called or the next column begins
+ *  @return the line strip vertices, screen coordinates
+ */
+const std::vector<ofVec3f>& ofxPlotDecimator::getLine() const { return line; }
+
+/**
+ *  @brief Retrieve the number of bytes allocated for the line
+ *  @return the number of bytes
+ */
+size_t ofxPlotDecimator::getMemoryUsage() const { return line.capacity()*sizeof(ofVec3f); }
+
+/**
+ *  @brief Retrieve the retained points of the current column
+ *  @param out vertices of the current column, screen coordinates, in index
+ *  order; cleared first
+ */
+void ofxPlotDecimator::getPending(std::vector<ofVec3f> &out) const{
+	out.clear();
+	if(bOpen)
+		emit(out);
+}//====================================================
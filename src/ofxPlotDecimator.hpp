@@ -0,0 +1,80 @@
+/**
+ * @file ofxPlotDecimator.hpp
+ * @brief Streaming per-pixel-column min/max decimation
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "dataPt.hpp"
+
+#include "ofMain.h"
+
+#include <vector>
+
+/**
+ *  @brief Reduces a series to a line strip with at most four vertices per
+ *  pixel column
+ *  @details Consecutive points that fall in the same pixel column are reduced
+ *  to the first, lowest, highest, and last of them, in their original order; a
+ *  line through these points covers the same pixels as a line through all of
+ *  them. Points are consumed in index order and the decimator may be resumed at
+ *  any point, so a large series can be decimated a piece at a time. Only the
+ *  points of the current column are retained, not the data.
+ */
+class ofxPlotDecimator{
+public:
+	void reset(const ofVec2f&, double, double);
+	void restart();
+
+	void add(const std::vector<dataPt>&, size_t);
+	void finish();
+
+	size_t getCount() const;
+	const std::vector<ofVec3f>& getLine() const;
+	size_t getMemoryUsage() const;
+	void getPending(std::vector<ofVec3f>&) const;
+
+protected:
+	/**
+	 *  @brief A retained point of the current column
+	 */
+	struct Sample{
+		size_t ix = 0;		//!< Index of the point in the data
+		ofVec2f pt;			//!< Location of the point, screen coordinates
+	};
+
+	ofVec2f dataOrigin;			//!< Location of the data origin, screen coordinates
+	double xScale = 1;			//!< Horizontal scaling, pixels per data unit
+	double yScale = 1;			//!< Vertical scaling, pixels per data unit
+
+	std::vector<ofVec3f> line;	//!< Vertices of the completed columns, screen coordinates
+	Sample first, lo, hi, last;	//!< Retained points of the current column; lo is highest on screen
+	double col = 0;				//!< Pixel column of the current column
+	bool bOpen = false;			//!< Whether or not the current column holds any points
+	size_t count = 0;			//!< Number of points consumed
+
+	void emit(std::vector<ofVec3f>&) const;
+};
@@ -0,0 +1,287 @@
+/**
+ * @file ofxPlotDensityGrid.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotDensityGrid.hpp"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a default density grid
+ *  @details The default color map runs from transparent through dark purple,
+ *  red, and orange to pale yellow
+ */
+ofxPlotDensityGrid::ofxPlotDensityGrid(){
+	std::vector<ofColor> colors;
+	colors.push_back(ofColor(40, 10, 80, 0));
+	colors.push_back(ofColor(90, 20, 110, 200));
+	colors.push_back(ofColor(190, 40, 80, 235));
+	colors.push_back(ofColor(245, 130, 20, 250));
+	colors.push_back(ofColor(250, 250, 160, 255));
+	setColorMap(colors);
+	pool = ofxPlotThreadPool::getShared();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Binning and Rendering --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Count the data points that fall within each pixel of an area
+ *  @details Equivalent to reset() followed by add()
+ * 
+ *  @param data data points
+ *  @param origin location of the data origin, (0,0), in screen coordinates
+ *  @param xScale horizontal scaling, pixels per data unit
+ *  @param yScale vertical scaling, pixels per data unit
+ *  @param area screen area covered by the grid; one bin per pixel
+ */
+void ofxPlotDensityGrid::bin(const std::vector<dataPt> &data, ofVec2f origin,
+	double xScale, double yScale, ofRectangle area){
+
+	reset(area);
+	add(data, origin, xScale, yScale);
+}//====================================================
+
+/**
+ *  @brief Size the grid to cover an area and empty all bins
+ *  @param area screen area covered by the grid; one bin per pixel
+ */
+void ofxPlotDensityGrid::reset(ofRectangle area){
+	gridPos = ofVec2f(area.x, area.y);
+	width = std::max(1, (int)std::ceil(area.width));
+	height = std::max(1, (int)std::ceil(area.height));
+
+	counts.assign((size_t)width*height, 0);
+	maxCount = 0;
+}//====================================================
+
+/**
+ *  @brief Add data points to the bins they fall within
+ *  @details Points outside the grid are counted in the nearest edge bin
+ * 
+ *  @param data data points
+ *  @param origin location of the data origin, (0,0), in screen coordinates
+ *  @param xScale horizontal scaling, pixels per data unit
+ *  @param yScale vertical scaling, pixels per data unit; screen y increases
+ *  downward, so points with larger dependent values are placed higher
+ */
+void ofxPlotDensityGrid::add(const std::vector<dataPt> &data, ofVec2f origin,
+	double xScale, double yScale){
+
+	add(std::vector<const std::vector<dataPt>*>(1, &data), origin, xScale, yScale);
+}//====================================================
+
+/**
+ *  @brief Add the data points of several series to the bins they fall within
+ *  @details All series are binned in a single pass: the points are treated
+ *  as one sequence and split into contiguous spans, one per task. Points
+ *  outside the grid are counted in the nearest edge bin.
+ * 
+ *  @param data pointers to the data points of each series
+ *  @param origin location of the data origin, (0,0), in screen coordinates
+ *  @param xScale horizontal scaling, pixels per data unit
+ *  @param yScale vertical scaling, pixels per data unit; screen y increases
+ *  downward, so points with larger dependent values are placed higher
+ */
+void ofxPlotDensityGrid::add(const std::vector<const std::vector<dataPt>*> &data,
+	ofVec2f origin, double xScale, double yScale){
+
+	size_t numBins = counts.size();
+
+	// Index of the first point of each series in the combined sequence
+	std::vector<size_t> offsets(1, 0);
+	for(size_t s = 0; s < data.size(); s++){
+		offsets.push_back(offsets.back() + data[s]->size());
+	}
+	size_t total = offsets.back();
+
+	// Position of the data origin relative to the top-left corner of the grid
+	double x0 = origin.x - gridPos.x;
+	double y0 = origin.y - gridPos.y;
+
+	size_t nSpans = numThreads > 0 ? numThreads : pool->getNumThreads() + 1;
+	nSpans = std::max<size_t>(1, std::min<size_t>(nSpans, total/minPtsPerThread));
+
+	// Bin the points [first, last) of the combined sequence
+	auto binSpan = [&](size_t first, size_t last, uint32_t *hist){
+		size_t s = std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+		for(; first < last; s++){
+			const std::vector<dataPt> &pts = *data[s];
+			size_t end = std::min(last, offsets[s + 1]);
+			for(size_t i = first - offsets[s]; i < end - offsets[s]; i++){
+				int ix = (int)(x0 + xScale*pts[i].indVar);
+				int iy = (int)(y0 - yScale*pts[i].depVar);
+				ix = std::min(std::max(ix, 0), width - 1);
+				iy = std::min(std::max(iy, 0), height - 1);
+				hist[(size_t)iy*width + ix]++;
+			}
+			first = end;
+		}
+	};
+
+	if(nSpans == 1){
+		if(total > 0)
+			binSpan(0, total, &counts[0]);
+	}else{
+		// Each span is binned into a private histogram; the first span bins
+		// directly into the grid...
+		partial.resize((nSpans - 1)*numBins);
+		size_t chunk = total/nSpans;
+		pool->parallelFor(nSpans, [&](size_t t){
+			size_t last = t == nSpans - 1 ? total : (t + 1)*chunk;
+			uint32_t *hist = &counts[0];
+			if(t > 0){
+				hist = &partial[(t - 1)*numBins];
+				std::fill(hist, hist + numBins, 0);
+			}
+			binSpan(t*chunk, last, hist);
+		});
+
+		// ...and the histograms are summed, split by rows
+		int rows = height/(int)nSpans;
+		pool->parallelFor(nSpans, [&](size_t t){
+			int lastRow = t == nSpans - 1 ? height : (int)(t + 1)*rows;
+			size_t first = (size_t)t*rows*width, last = (size_t)lastRow*width;
+			for(size_t p = 0; p < nSpans - 1; p++){
+				const uint32_t *src = &partial[p*numBins];
+				for(size_t b = first; b < last; b++){
+					counts[b] += src[b];
+				}
+			}
+		});
+	}
+
+	maxCount = *std::max_element(counts.begin(), counts.end());
+}//====================================================
+
+/**
+ *  @brief Color-map the bin counts into an image
+ *  @details Counts are scaled logarithmically, so sparse regions remain
+ *  visible next to dense ones; empty bins map to the first color in the
+ *  color map. Each pixel of the image corresponds to one bin.
+ * 
+ *  @param pix image to fill; it is reallocated to the size of the grid
+ */
+void ofxPlotDensityGrid::toPixels(ofPixels &pix) const{
+	pix.allocate(width, height, OF_PIXELS_RGBA);
+	unsigned char *out = pix.getData();
+
+	double norm = maxCount > 0 ? 255.0/std::log1p((double)maxCount) : 0;
+	for(size_t b = 0; b < counts.size(); b++){
+		int lut = counts[b] == 0 ? 0 : std::max(1, std::min(255, (int)(norm*std::log1p((double)counts[b]))));
+		const ofColor &c = colorLUT[lut];
+		out[4*b] = c.r;
+		out[4*b + 1] = c.g;
+		out[4*b + 2] = c.b;
+		out[4*b + 3] = c.a;
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the number of points in a bin
+ * 
+ *  @param x horizontal bin index (pixels from the left edge of the area)
+ *  @param y vertical bin index (pixels from the top edge of the area)
+ *  @return the number of points in the bin
+ */
+uint32_t ofxPlotDensityGrid::getCount(int x, int y) const{
+	if(x < 0 || x >= width || y < 0 || y >= height)
+		return 0;
+
+	return counts[(size_t)y*width + x];
+}//====================================================
+
+/**
+ *  @brief Retrieve the largest number of points in any bin
+ *  @return the largest number of points in any bin
+ */
+uint32_t ofxPlotDensityGrid::getMaxCount() const { return maxCount; }
+
+/**
+ *  @brief Retrieve the number of bytes allocated for the bins and colors
+ *  @return the number of bytes
+ */
+size_t ofxPlotDensityGrid::getMemoryUsage() const{
+	return (counts.capacity() + partial.capacity())*sizeof(uint32_t) + colorLUT.capacity()*sizeof(ofColor);
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of bins in the horizontal direction
+ *  @return the number of bins in the horizontal direction
+ */
+int ofxPlotDensityGrid::getWidth() const { return width; }
+
+/**
+ *  @brief Retrieve the number of bins in the vertical direction
+ *  @return the number of bins in the vertical direction
+ */
+int ofxPlotDensityGrid::getHeight() const { return height; }
+
+/**
+ *  @brief Set the colors used to represent the density
+ *  @details The colors are evenly spaced between the lowest (empty) and
+ *  highest densities and linearly interpolated in between
+ * 
+ *  @param colors at least two colors, from lowest to highest density
+ */
+void ofxPlotDensityGrid::setColorMap(std::vector<ofColor> colors){
+	if(colors.size() < 2){
+		ofLogWarning("ofxPlotDensityGrid") << "setColorMap: at least two colors are required";
+		return;
+	}
+
+	colorLUT.assign(256, ofColor());
+	for(int i = 0; i < 256; i++){
+		float pos = i/255.f*(colors.size() - 1);
+		size_t lower = std::min((size_t)pos, colors.size() - 2);
+		colorLUT[i] = colors[lower].getLerped(colors[lower + 1], pos - lower);
+	}
+}//====================================================
+
+/**
+ *  @brief Set the maximum number of spans the data are split into
+ *  @details Each span is binned by one task on the thread pool. Small data
+ *  sets are always split into fewer spans.
+ * 
+ *  @param n maximum number of spans; zero uses one per core
+ */
+void ofxPlotDensityGrid::setNumThreads(unsigned int n){ numThreads = n; }
+
+/**
+ *  @brief Set the thread pool that bins the data
+ *  @param p pointer to the pool; nullptr uses the shared pool
+ */
+void ofxPlotDensityGrid::setThreadPool(std::shared_ptr<ofxPlotThreadPool> p){
+	pool = p ? p : ofxPlotThreadPool::getShared();
+}//====================================================
@@ -0,0 +1,81 @@
+/**
+ * @file ofxPlotDensityGrid.hpp
+ * @brief Bins data points into a pixel grid to visualize data density
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "dataPt.hpp"
+#include "ofxPlotThreadPool.hpp"
+
+#include "ofMain.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ *  @brief A two-dimensional histogram of data points, one bin per pixel
+ *  @details Binning is a single linear pass over the data of all series,
+ *  split into spans that run on a thread pool; each span fills a private
+ *  histogram and the histograms are summed at the end, so no synchronization
+ *  is required in the inner loop. The private histograms are kept between
+ *  passes so that rebuilding the grid does not reallocate them.
+ */
+class ofxPlotDensityGrid{
+public:
+	ofxPlotDensityGrid();
+
+	void add(const std::vector<dataPt>&, ofVec2f, double, double);
+	void add(const std::vector<const std::vector<dataPt>*>&, ofVec2f, double, double);
+	void bin(const std::vector<dataPt>&, ofVec2f, double, double, ofRectangle);
+	void reset(ofRectangle);
+	void toPixels(ofPixels&) const;
+
+	uint32_t getCount(int, int) const;
+	uint32_t getMaxCount() const;
+	size_t getMemoryUsage() const;
+	int getWidth() const;
+	int getHeight() const;
+
+	void setColorMap(std::vector<ofColor>);
+	void setNumThreads(unsigned int);
+	void setThreadPool(std::shared_ptr<ofxPlotThreadPool>);
+
+protected:
+	std::vector<uint32_t> counts;	//!< Number of points in each bin, row-major
+	std::vector<uint32_t> partial;	//!< Private histograms for all but the first span, reused between passes
+	std::vector<ofColor> colorLUT;	//!< Colors for normalized (log) counts between 0 and 1, 256 entries
+
+	ofVec2f gridPos;				//!< Location of the top-left corner of the grid, screen coordinates
+	int width = 0;					//!< Number of bins in the horizontal direction
+	int height = 0;					//!< Number of bins in the vertical direction
+	uint32_t maxCount = 0;			//!< Largest count in any bin
+	unsigned int numThreads = 0;	//!< Maximum number of spans to bin in parallel; zero uses all cores
+	std::shared_ptr<ofxPlotThreadPool> pool;	//!< Pool that bins the spans
+
+	/** Minimum number of points each span should bin to be worth the extra histogram */
+	static const size_t minPtsPerThread = 1 << 16;
+};
@@ -0,0 +1,333 @@
+/**
+ * @file ofxPlotDispatcher.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotDispatcher.hpp"
+
+#include "interactiveObj.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a dispatcher that listens to the global mouse events
+ */
+ofxPlotDispatcher::ofxPlotDispatcher(){
+	ofAddListener(ofEvents().mouseMoved, this, &ofxPlotDispatcher::mouseMoved);
+	ofAddListener(ofEvents().mousePressed, this, &ofxPlotDispatcher::mousePressed);
+	ofAddListener(ofEvents().mouseReleased, this, &ofxPlotDispatcher::mouseReleased);
+	ofAddListener(ofEvents().mouseDragged, this, &ofxPlotDispatcher::mouseDragged);
+}//====================================================
+
+/**
+ *  @brief Destructor
+ *  @details Any objects still in the dispatcher return to listening to
+ *  the global mouse events
+ */
+ofxPlotDispatcher::~ofxPlotDispatcher(){
+	ofRemoveListener(ofEvents().mouseMoved, this, &ofxPlotDispatcher::mouseMoved);
+	ofRemoveListener(ofEvents().mousePressed, this, &ofxPlotDispatcher::mousePressed);
+	ofRemoveListener(ofEvents().mouseReleased, this, &ofxPlotDispatcher::mouseReleased);
+	ofRemoveListener(ofEvents().mouseDragged, this, &ofxPlotDispatcher::mouseDragged);
+
+	std::vector<InteractiveObj*> objs;
+	for(auto &e : entries){
+		objs.push_back(e.first);
+	}
+
+	for(size_t i = 0; i < objs.size(); i++){
+		objs[i]->setDispatcher(nullptr);
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Route an object's pointer events through this dispatcher
+ *  @details Equivalent to obj->setDispatcher(this)
+ *  @param obj pointer to the object; the object must remain in scope
+ *  until it is removed or destroyed
+ */
+void ofxPlotDispatcher::add(InteractiveObj *obj){
+	if(obj)
+		obj->setDispatcher(this);
+}//====================================================
+
+/**
+ *  @brief Return an object to listening to the global mouse events
+ *  @details Equivalent to obj->setDispatcher(nullptr)
+ *  @param obj pointer to the object
+ */
+void ofxPlotDispatcher::remove(InteractiveObj *obj){
+	if(obj && entries.count(obj) > 0)
+		obj->setDispatcher(nullptr);
+}//====================================================
+
+/**
+ *  @brief Locate the objects whose viewports contain a point
+ * 
+ *  @param x horizontal coordinate, pixels, screen coordinates
+ *  @param y vertical coordinate, pixels, screen coordinates
+ *  @param objs cleared and filled with the objects that contain the
+ *  point, in the order they were added
+ */
+void ofxPlotDispatcher::getObjectsAt(float x, float y, std::vector<InteractiveObj*> &objs) const{
+	objs.clear();
+
+	auto cell = cells.find(cellKey(std::floor(x/cellSize), std::floor(y/cellSize)));
+	if(cell == cells.end())
+		return;
+
+	for(size_t i = 0; i < cell->second.size(); i++){
+		if(entries.at(cell->second[i]).bounds.inside(x, y))
+			objs.push_back(cell->second[i]);
+	}
+
+	sortByOrder(objs);
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of objects in the dispatcher
+ *  @return the number of objects in the dispatcher
+ */
+size_t ofxPlotDispatcher::getNumObjects() const { return entries.size(); }
+
+/**
+ *  @brief Set the size of the grid cells used to index the objects
+ *  @details Cells comparable to the size of the smallest objects work well;
+ *  an object is stored in every cell its viewport overlaps.
+ *  @param size width and height of a cell, pixels
+ */
+void ofxPlotDispatcher::setCellSize(float size){
+	if(size <= 0){
+		ofLogWarning("ofxPlotDispatcher") << "setCellSize: size must be positive";
+		return;
+	}
+
+	cellSize = size;
+	cells.clear();
+	for(auto &e : entries){
+		index(e.first, e.second.bounds);
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Event Handlers --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Deliver a mouse move to the objects beneath the cursor and
+ *  to the objects the cursor just left
+ *  @param mouse mouse event arguments
+ */
+void ofxPlotDispatcher::mouseMoved(ofMouseEventArgs &mouse){
+	std::vector<InteractiveObj*> under;
+	getObjectsAt(mouse.x, mouse.y, under);
+
+	targets = under;
+	for(size_t i = 0; i < hovered.size(); i++){
+		if(std::find(under.begin(), under.end(), hovered[i]) == under.end())
+			targets.push_back(hovered[i]);
+	}
+	sortByOrder(targets);
+	hovered.swap(under);
+
+	std::vector<InteractiveObj*> recipients;
+	recipients.swap(targets);
+	for(size_t i = 0; i < recipients.size(); i++){
+		if(entries.count(recipients[i]) > 0)	// Skip objects removed by an earlier recipient
+			recipients[i]->mouseMoved(mouse);
+	}
+}//====================================================
+
+/**
+ *  @brief Deliver a mouse press to the objects beneath the cursor
+ *  @details These objects capture the mouse until it is released
+ *  @param mouse mouse event arguments
+ */
+void ofxPlotDispatcher::mousePressed(ofMouseEventArgs &mouse){
+	getObjectsAt(mouse.x, mouse.y, captured);
+
+	std::vector<InteractiveObj*> recipients = captured;
+	for(size_t i = 0; i < recipients.size(); i++){
+		if(entries.count(recipients[i]) > 0)
+			recipients[i]->mousePressed(mouse);
+	}
+}//====================================================
+
+/**
+ *  @brief Deliver a mouse release to the objects that captured the mouse
+ *  and the objects beneath the cursor
+ *  @param mouse mouse event arguments
+ */
+void ofxPlotDispatcher::mouseReleased(ofMouseEventArgs &mouse){
+	std::vector<InteractiveObj*> recipients;
+	getObjectsAt(mouse.x, mouse.y, recipients);
+	for(size_t i = 0; i < captured.size(); i++){
+		if(std::find(recipients.begin(), recipients.end(), captured[i]) == recipients.end())
+			recipients.push_back(captured[i]);
+	}
+	sortByOrder(recipients);
+	captured.clear();
+
+	for(size_t i = 0; i < recipients.size(); i++){
+		if(entries.count(recipients[i]) > 0)
+			recipients[i]->mouseReleased(mouse);
+	}
+}//====================================================
+
+/**
+ *  @brief Deliver a mouse drag to the objects that captured the mouse
+ *  @param mouse mouse event arguments
+ */
+void ofxPlotDispatcher::mouseDragged(ofMouseEventArgs &mouse){
+	std::vector<InteractiveObj*> recipients = captured;
+	for(size_t i = 0; i < recipients.size(); i++){
+		if(entries.count(recipients[i]) > 0)
+			recipients[i]->mouseDragged(mouse);
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Indexing --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add an object to the index
+ *  @details Called by InteractiveObj when its dispatcher is set
+ *  @param obj pointer to the object
+ */
+void ofxPlotDispatcher::attach(InteractiveObj *obj){
+	if(entries.count(obj) > 0)
+		return;
+
+	Entry &e = entries[obj];
+	e.order = nextOrder++;
+	e.bounds = obj->getViewport().getStandardized();
+	index(obj, e.bounds);
+}//====================================================
+
+/**
+ *  @brief Remove an object from the index and from any hover or
+ *  capture state
+ *  @param obj pointer to the object
+ */
+void ofxPlotDispatcher::detach(InteractiveObj *obj){
+	auto it = entries.find(obj);
+	if(it == entries.end())
+		return;
+
+	unindex(obj, it->second.bounds);
+	entries.erase(it);
+
+	hovered.erase(std::remove(hovered.begin(), hovered.end(), obj), hovered.end());
+	captured.erase(std::remove(captured.begin(), captured.end(), obj), captured.end());
+}//====================================================
+
+/**
+ *  @brief Update the index after an object's viewport changes
+ *  @param obj pointer to the object
+ */
+void ofxPlotDispatcher::reindex(InteractiveObj *obj){
+	auto it = entries.find(obj);
+	if(it == entries.end())
+		return;
+
+	ofRectangle bounds = obj->getViewport().getStandardized();
+	if(bounds == it->second.bounds)
+		return;
+
+	unindex(obj, it->second.bounds);
+	it->second.bounds = bounds;
+	index(obj, bounds);
+}//====================================================
+
+/**
+ *  @brief Combine grid cell coordinates into a single key
+ * 
+ *  @param cx horizontal cell index
+ *  @param cy vertical cell index
+ *  @return key that identifies the cell
+ */
+int64_t ofxPlotDispatcher::cellKey(int cx, int cy) const{
+	return ((int64_t)cx << 32) | (uint32_t)cy;
+}//====================================================
+
+/**
+ *  @brief Store an object in every cell that a rectangle overlaps
+ * 
+ *  @param obj pointer to the object
+ *  @param r rectangle, screen coordinates
+ */
+void ofxPlotDispatcher::index(InteractiveObj *obj, const ofRectangle &r){
+	int x0 = std::floor(r.x/cellSize), x1 = std::floor((r.x + r.width)/cellSize);
+	int y0 = std::floor(r.y/cellSize), y1 = std::floor((r.y + r.height)/cellSize);
+
+	for(int cx = x0; cx <= x1; cx++){
+		for(int cy = y0; cy <= y1; cy++){
+			cells[cellKey(cx, cy)].push_back(obj);
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Remove an object from every cell that a rectangle overlaps
+ * 
+ *  @param obj pointer to the object
+ *  @param r rectangle the object was indexed with, screen coordinates
+ */
+void ofxPlotDispatcher::unindex(InteractiveObj *obj, const ofRectangle &r){
+	int x0 = std::floor(r.x/cellSize), x1 = std::floor((r.x + r.width)/cellSize);
+	int y0 = std::floor(r.y/cellSize), y1 = std::floor((r.y + r.height)/cellSize);
+
+	for(int cx = x0; cx <= x1; cx++){
+		for(int cy = y0; cy <= y1; cy++){
+			auto cell = cells.find(cellKey(cx, cy));
+			if(cell == cells.end())
+				continue;
+
+			std::vector<InteractiveObj*> &objs = cell->second;
+			objs.erase(std::remove(objs.begin(), objs.end(), obj), objs.end());
+			if(objs.empty())
+				cells.erase(cell);
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Sort objects by the order in which they were added
+ *  @param objs objects in the dispatcher
+ */
+void ofxPlotDispatcher::sortByOrder(std::vector<InteractiveObj*> &objs) const{
+	std::sort(objs.begin(), objs.end(), [this](InteractiveObj *a, InteractiveObj *b){
+		return entries.at(a).order < entries.at(b).order;
+	});
+}//====================================================
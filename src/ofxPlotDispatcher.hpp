@@ -0,0 +1,100 @@
+/**
+ * @file ofxPlotDispatcher.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+class InteractiveObj;
+
+/**
+ *  @brief Routes pointer events to the objects beneath the cursor
+ *  @details By default, every InteractiveObj listens to the global mouse
+ *  events, so each event is delivered to every object. Objects added to a
+ *  dispatcher stop listening to the global events; the dispatcher listens
+ *  once and indexes the object viewports in a uniform grid so that each
+ *  event reaches only:
+ *  - the objects whose viewports contain the cursor,
+ *  - objects that were hovered by the previous move (so they can clear
+ *  their hover state), and
+ *  - objects that captured the mouse by being pressed, until it is released.
+ * 
+ *  Locating the objects beneath the cursor costs a single grid cell lookup,
+ *  independent of the number of objects. Objects are notified in the order
+ *  they were added. Keyboard events are not affected.
+ */
+class ofxPlotDispatcher{
+public:
+	ofxPlotDispatcher();
+	~ofxPlotDispatcher();
+
+	void add(InteractiveObj*);
+	void remove(InteractiveObj*);
+
+	void getObjectsAt(float, float, std::vector<InteractiveObj*>&) const;
+	size_t getNumObjects() const;
+	void setCellSize(float);
+
+	void mouseMoved(ofMouseEventArgs&);
+	void mousePressed(ofMouseEventArgs&);
+	void mouseReleased(ofMouseEventArgs&);
+	void mouseDragged(ofMouseEventArgs&);
+
+protected:
+	friend class InteractiveObj;
+
+	/**
+	 *  @brief Bookkeeping for an object in the dispatcher
+	 */
+	struct Entry{
+		size_t order = 0;			//!< Insertion sequence number; determines the notification order
+		ofRectangle bounds;			//!< Viewport the object is indexed under
+	};
+
+	float cellSize = 128;			//!< Width and height of a grid cell, pixels
+	size_t nextOrder = 0;			//!< Sequence number assigned to the next object
+
+	std::unordered_map<InteractiveObj*, Entry> entries;					//!< Objects in the dispatcher
+	std::unordered_map<int64_t, std::vector<InteractiveObj*> > cells;	//!< Objects that overlap each grid cell
+
+	std::vector<InteractiveObj*> hovered;	//!< Objects that contained the cursor at the last move
+	std::vector<InteractiveObj*> captured;	//!< Objects that were pressed and have not been released
+	std::vector<InteractiveObj*> targets;	//!< Scratch storage for the recipients of an event
+
+	void attach(InteractiveObj*);
+	void detach(InteractiveObj*);
+	void reindex(InteractiveObj*);
+
+	int64_t cellKey(int, int) const;
+	void index(InteractiveObj*, const ofRectangle&);
+	void unindex(InteractiveObj*, const ofRectangle&);
+	void sortByOrder(std::vector<InteractiveObj*>&) const;
+};
@@ -0,0 +1,308 @@
+/**
+ * @file ofxPlotExport.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotExport.hpp"
+
+#include "interactiveObj.hpp"
+#include "ofxPlot.hpp"
+#include "ofxPlotRaster.hpp"
+#include "ofxPlotRasterFont.hpp"
+#include "ofxPlotThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an exporter that uses the shared thread pool
+ */
+ofxPlotExport::ofxPlotExport(){
+	pool = ofxPlotThreadPool::getShared();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Export --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Export many plots, using every core
+ *  @details Call this from the render thread if any job writes a PNG file,
+ *  unless software rendering is enabled. The plots must not be modified, or updated, until this function returns;
+ *  a plot may appear in several jobs.
+ * 
+ *  @param jobs plots to export and their destination files
+ *  @return the number of plots exported and the rate at which they were
+ *  exported
+ */
+ofxPlotExport::Report ofxPlotExport::exportAll(const std::vector<Job> &jobs){
+	Report report;
+	report.numPlots = jobs.size();
+	std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+	std::atomic<size_t> numFailed(0);
+	std::vector<size_t> pngJobs;
+	for(size_t j = 0; j < jobs.size(); j++){
+		if(!jobs[j].plot){
+			numFailed++;
+		}else if(!bSoftware && !isSVG(jobs[j].path)){
+			pngJobs.push_back(j);
+		}
+	}
+
+	// Prepare every plot and write its SVG (and software-rendered PNG) files
+	// in parallel; jobs that share a plot run on the same thread
+	std::vector<ofxPlot*> plots;
+	std::vector<std::vector<size_t> > fileJobs;
+	std::unordered_map<ofxPlot*, size_t> plotIx;
+	for(size_t j = 0; j < jobs.size(); j++){
+		if(!jobs[j].plot)
+			continue;
+
+		size_t p = plotIx.emplace(jobs[j].plot, plots.size()).first->second;
+		if(p == plots.size()){
+			plots.push_back(jobs[j].plot);
+			fileJobs.push_back(std::vector<size_t>());
+		}
+		if(bSoftware || isSVG(jobs[j].path))
+			fileJobs[p].push_back(j);
+	}
+
+	pool->parallelFor(plots.size(), [&](size_t p){
+		plots[p]->prepare();
+		for(size_t k = 0; k < fileJobs[p].size(); k++){
+			const std::string &path = jobs[fileJobs[p][k]].path;
+			bool bSaved = isSVG(path) ? saveSVG(*plots[p], path) : saveRasterPNG(*plots[p], path, rasterFont);
+			if(!bSaved)
+				numFailed++;
+		}
+	});
+
+	// Render the PNG files a chunk at a time, then encode each chunk in parallel
+	std::vector<ofPixels> images;
+	ofFbo fbo;
+	for(size_t first = 0; first < pngJobs.size(); first += maxPendingImages){
+		size_t n = std::min(maxPendingImages, pngJobs.size() - first);
+		images.resize(n);
+		std::vector<bool> rendered(n, false);
+		for(size_t i = 0; i < n; i++){
+			rendered[i] = renderPixels(*jobs[pngJobs[first + i]].plot, images[i], fbo);
+		}
+
+		pool->parallelFor(n, [&](size_t i){
+			const std::string &path = jobs[pngJobs[first + i]].path;
+			if(!rendered[i] || !ofSaveImage(images[i], path)){
+				ofLogWarning("ofxPlotExport") << "exportAll: Could not write " << path;
+				numFailed++;
+			}
+		});
+	}
+
+	report.numFailed = numFailed;
+	report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	return report;
+}//====================================================
+
+/**
+ *  @brief Render an object into an image with an offscreen frame buffer
+ *  @details Call this from the render thread; an OpenGL context is required.
+ *  The image is the size of the object's viewport and is transparent where
+ *  the object draws nothing.
+ * 
+ *  @param obj object to render
+ *  @param pix image to render into; reallocated as needed
+ *  @return whether or not the object was rendered
+ */
+bool ofxPlotExport::renderPixels(InteractiveObj &obj, ofPixels &pix){
+	ofFbo fbo;
+	return renderPixels(obj, pix, fbo);
+}//====================================================
+
+/**
+ *  @brief Render an object into an image, reusing a frame buffer
+ *  @details The frame buffer is only reallocated when the object is a
+ *  different size than the previous one rendered into it
+ * 
+ *  @param obj object to render
+ *  @param pix image to render into; reallocated as needed
+ *  @param fbo frame buffer to render into
+ *  @return whether or not the object was rendered
+ */
+bool ofxPlotExport::renderPixels(InteractiveObj &obj, ofPixels &pix, ofFbo &fbo){
+	ofRectangle area = obj.getViewport().getStandardized();
+	int w = (int)std::ceil(area.width), h = (int)std::ceil(area.height);
+	if(w <= 0 || h <= 0){
+		ofLogWarning("ofxPlotExport") << "renderPixels: The object has an empty viewport";
+		return false;
+	}
+
+	if(!fbo.isAllocated() || (int)fbo.getWidth() != w || (int)fbo.getHeight() != h)
+		fbo.allocate(w, h, GL_RGBA, 4);
+
+	if(!fbo.isAllocated()){
+		ofLogWarning("ofxPlotExport") << "renderPixels: Could not allocate a " << w << "x" << h << " frame buffer";
+		return false;
+	}
+
+	fbo.begin();
+	ofClear(0, 0, 0, 0);
+	ofPushMatrix();
+	ofTranslate(-area.x, -area.y);
+	obj.draw();
+	ofPopMatrix();
+	fbo.end();
+
+	fbo.readToPixels(pix);
+	return pix.isAllocated();
+}//====================================================
+
+/**
+ *  @brief Render an object and save it as a PNG file
+ *  @details Call this from the render thread; an OpenGL context is required
+ * 
+ *  @param obj object to render
+ *  @param path destination file, relative to the data folder
+ *  @return whether or not the file was written
+ */
+bool ofxPlotExport::savePNG(InteractiveObj &obj, const std::string &path){
+	ofPixels pix;
+	if(!renderPixels(obj, pix) || !ofSaveImage(pix, path)){
+		ofLogWarning("ofxPlotExport") << "savePNG: Could not write " << path;
+		return false;
+	}
+	return true;
+}//====================================================
+
+/**
+ *  @brief Rasterize a plot on the CPU and save it as a PNG file
+ *  @details No OpenGL context is required, so this may be called from any
+ *  thread, as long as no other thread is using the plot
+ *  @see ofxPlotRaster
+ * 
+ *  @param plot plot to save
+ *  @param path destination file, relative to the data folder
+ *  @param font font to draw text with; nullptr to omit text
+ *  @return whether or not the file was written
+ */
+bool ofxPlotExport::saveRasterPNG(ofxPlot &plot, const std::string &path, std::shared_ptr<ofxPlotRasterFont> font){
+	ofxPlotRaster raster(font);
+	plot.drawTo(raster);
+
+	const ofPixels &pix = raster.getPixels();
+	if(pix.getWidth() == 0 || pix.getHeight() == 0 || !ofSaveImage(pix, path)){
+		ofLogWarning("ofxPlotExport") << "saveRasterPNG: Could not write " << path;
+		return false;
+	}
+	return true;
+}//====================================================
+
+/**
+ *  @brief Save a plot as an SVG file
+ *  @details No OpenGL context is required, so this may be called from any
+ *  thread, as long as no other thread is using the plot
+ * 
+ *  @param plot plot to save
+ *  @param path destination file, relative to the data folder
+ *  @return whether or not the file was written
+ */
+bool ofxPlotExport::saveSVG(ofxPlot &plot, const std::string &path){
+	std::ofstream file(ofToDataPath(path, true).c_str());
+	if(file.is_open())
+		plot.writeSVG(file);
+
+	if(!file.is_open() || !file.good()){
+		ofLogWarning("ofxPlotExport") << "saveSVG: Could not write " << path;
+		return false;
+	}
+	return true;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Set the number of rendered images held in memory at once
+ *  @details Larger values keep more cores busy encoding; each image holds
+ *  four bytes per pixel
+ *  @param n number of images; values below one are treated as one
+ */
+void ofxPlotExport::setMaxPendingImages(size_t n){ maxPendingImages = std::max<size_t>(n, 1); }
+
+/**
+ *  @brief Choose how PNG files are rendered
+ * 
+ *  @param b whether PNG files are rasterized on the CPU (true) or rendered
+ *  with OpenGL (false, the default)
+ *  @param f font for software-rendered text; nullptr to omit text
+ */
+void ofxPlotExport::setSoftwareRendering(bool b, std::shared_ptr<ofxPlotRasterFont> f){
+	bSoftware = b;
+	rasterFont = f;
+}//====================================================
+
+/**
+ *  @brief Set the thread pool that runs the export
+ *  @param p pointer to the pool; nullptr uses the shared pool
+ */
+void ofxPlotExport::setThreadPool(std::shared_ptr<ofxPlotThreadPool> p){
+	pool = p ? p : ofxPlotThreadPool::getShared();
+}//====================================================
+
+/**
+ *  @brief Retrieve the export rate
+ *  @return the number of plots exported per second of wall time
+ */
+double ofxPlotExport::Report::getPlotsPerSecond() const{
+	return seconds > 0 ? (numPlots - numFailed)/seconds : 0;
+}//====================================================
+
+/**
+ *  @brief Summarize the export
+ *  @return a one-line summary
+ */
+std::string ofxPlotExport::Report::toString() const{
+	std::ostringstream out;
+	out << numPlots - numFailed << "/" << numPlots << " plots exported in " << seconds << " s ("
+		<< getPlotsPerSecond() << " plots/s)";
+	return out.str();
+}//====================================================
+
+/**
+ *  @brief Determine whether a path names an SVG file
+ *  @param path file path
+ *  @return whether or not the extension is ".svg", ignoring case
+ */
+bool ofxPlotExport::isSVG(const std::string &path){
+	return ofToLower(ofFilePath::getFileExt(path)) == "svg";
+}//====================================================
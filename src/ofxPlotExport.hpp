@@ -0,0 +1,103 @@
+/**
+ * @file ofxPlotExport.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations
+class InteractiveObj;
+class ofxPlot;
+class ofxPlotRasterFont;
+class ofxPlotThreadPool;
+
+/**
+ *  @brief Saves plots to PNG and SVG files without a visible window
+ *  @details PNG files are rendered into an offscreen frame buffer with the
+ *  plot's own draw(), so they match what is shown on screen; this needs an
+ *  OpenGL context (on a server without a display, run under a virtual X
+ *  server or with an offscreen GL window), and the rendering itself must
+ *  happen on the render thread. SVG files are written directly from the
+ *  plot's geometry (see ofxPlot::writeSVG()) and need no context at all.
+ * 
+ *  exportAll() fans a list of jobs out across a thread pool: every plot is
+ *  prepared, and every SVG written, in parallel; PNG jobs are rendered on
+ *  the calling thread a chunk at a time, and the chunk is then encoded and
+ *  written in parallel while the next chunk waits.
+ * 
+ *  With software rendering enabled (see setSoftwareRendering()), PNG files
+ *  are rasterized on the CPU with ofxPlotRaster instead, so no OpenGL
+ *  context is needed and every PNG job runs in parallel, like the SVG jobs.
+ */
+class ofxPlotExport{
+public:
+	/**
+	 *  @brief A plot to export and the file to export it to
+	 */
+	struct Job{
+		ofxPlot *plot = nullptr;	//!< Plot to export; must not be modified during the export
+		std::string path = "";		//!< Destination file; the format is chosen by the extension, ".png" or ".svg"
+	};
+
+	/**
+	 *  @brief Outcome of exportAll()
+	 */
+	struct Report{
+		size_t numPlots = 0;		//!< Number of jobs that were attempted
+		size_t numFailed = 0;		//!< Number of jobs that did not produce a file
+		double seconds = 0;			//!< Wall time of the whole export, seconds
+
+		double getPlotsPerSecond() const;
+		std::string toString() const;
+	};
+
+	ofxPlotExport();
+
+	Report exportAll(const std::vector<Job>&);
+
+	void setMaxPendingImages(size_t);
+	void setSoftwareRendering(bool, std::shared_ptr<ofxPlotRasterFont> = nullptr);
+	void setThreadPool(std::shared_ptr<ofxPlotThreadPool>);
+
+	static bool isSVG(const std::string&);
+	static bool renderPixels(InteractiveObj&, ofPixels&);
+	static bool savePNG(InteractiveObj&, const std::string&);
+	static bool saveRasterPNG(ofxPlot&, const std::string&, std::shared_ptr<ofxPlotRasterFont> = nullptr);
+	static bool saveSVG(ofxPlot&, const std::string&);
+
+protected:
+	std::shared_ptr<ofxPlotThreadPool> pool;	//!< Pool that prepares, writes, and encodes in parallel
+	size_t maxPendingImages = 64;				//!< Most rendered images held in memory while they are encoded
+	bool bSoftware = false;						//!< Whether or not PNG files are rasterized on the CPU
+	std::shared_ptr<ofxPlotRasterFont> rasterFont;	//!< Font for software-rendered text; may be nullptr
+
+	static bool renderPixels(InteractiveObj&, ofPixels&, ofFbo&);
+};
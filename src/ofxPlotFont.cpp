@@ -0,0 +1,189 @@
+/**
+ * @file ofxPlotFont.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotFont.hpp"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an empty font; isLoaded() returns false
+ */
+ofxPlotFont::ofxPlotFont(){}
+
+/**
+ *  @brief Construct from a font that has already been loaded
+ *  @details The font is copied, including its glyph atlas; prefer
+ *  getShared() so that widgets share a single copy
+ *  @param f font
+ */
+ofxPlotFont::ofxPlotFont(const ofTrueTypeFont &f) : font(f){}
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve a font shared by the whole application
+ *  @details Each face and size is loaded, antialiased with the full character
+ *  set, the first time it is requested while no widget holds it; later
+ *  requests return the same font.
+ * 
+ *  @param path font file, relative to the data directory
+ *  @param size font size, points
+ *  @return the font, or nullptr if it could not be loaded
+ */
+std::shared_ptr<ofxPlotFont> ofxPlotFont::getShared(const std::string &path, int size){
+	static std::mutex mtx;
+	static std::map<std::pair<std::string, int>, std::weak_ptr<ofxPlotFont> > fonts;
+
+	std::lock_guard<std::mutex> lock(mtx);
+	std::weak_ptr<ofxPlotFont> &entry = fonts[std::make_pair(path, size)];
+	std::shared_ptr<ofxPlotFont> f = entry.lock();
+	if(f)
+		return f;
+
+	f = std::make_shared<ofxPlotFont>();
+	if(!f->font.load(path, size, true, true)){
+		ofLogWarning("ofxPlotFont") << "getShared: could not load " << path << " at size " << size;
+		fonts.erase(std::make_pair(path, size));
+		return nullptr;
+	}
+
+	entry = f;
+	return f;
+}//====================================================
+
+/**
+ *  @brief Retrieve the underlying font
+ *  @return the font
+ */
+const ofTrueTypeFont& ofxPlotFont::getFont() const { return font; }
+
+/**
+ *  @brief Retrieve the distance between lines of text
+ *  @return the line height, pixels
+ */
+float ofxPlotFont::getLineHeight() const { return font.getLineHeight(); }
+
+/**
+ *  @brief Retrieve the number of bytes held by the glyph atlas
+ *  @details Estimated from the size of the atlas texture
+ *  @return the number of bytes, on the GPU
+ */
+size_t ofxPlotFont::getMemoryUsage() const{
+	if(!font.isLoaded())
+		return 0;
+
+	const ofTexture &atlas = font.getFontTexture();
+	return (size_t)atlas.getWidth()*(size_t)atlas.getHeight()*2;	// Luminance + alpha
+}//====================================================
+
+/**
+ *  @brief Determine whether the font has been loaded
+ *  @return whether or not the font can be drawn
+ */
+bool ofxPlotFont::isLoaded() const { return font.isLoaded(); }
+
+/**
+ *  @brief Set the extra space between letters
+ *  @details Affects every widget that shares this font
+ *  @param spacing letter spacing, as a multiple of the default
+ */
+void ofxPlotFont::setLetterSpacing(float spacing){
+	font.setLetterSpacing(spacing);
+	std::lock_guard<std::mutex> lock(boxesMtx);
+	boxes.clear();
+}//====================================================
+
+/**
+ *  @brief Set the distance between lines of text
+ *  @details Affects every widget that shares this font
+ *  @param height line height, pixels
+ */
+void ofxPlotFont::setLineHeight(float height){
+	font.setLineHeight(height);
+	std::lock_guard<std::mutex> lock(boxesMtx);
+	boxes.clear();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Text --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Draw a string
+ * 
+ *  @param str string
+ *  @param x horizontal location of the string's origin, pixels
+ *  @param y vertical location of the string's baseline, pixels
+ */
+void ofxPlotFont::drawString(const std::string &str, float x, float y) const{
+	font.drawString(str, x, y);
+}//====================================================
+
+/**
+ *  @brief Measure a string
+ *  @details The box is measured once per string and translated to the
+ *  requested location. Safe to call from several threads at once.
+ * 
+ *  @param str string
+ *  @param x horizontal location of the string's origin, pixels
+ *  @param y vertical location of the string's baseline, pixels
+ *  @return the bounding box of the string
+ */
+ofRectangle ofxPlotFont::getStringBoundingBox(const std::string &str, float x, float y) const{
+	ofRectangle box;
+	bool found = false;
+	{
+		std::lock_guard<std::mutex> lock(boxesMtx);
+		std::unordered_map<std::string, ofRectangle>::const_iterator it = boxes.find(str);
+		if(it != boxes.end()){
+			box = it->second;
+			found = true;
+		}
+	}
+
+	if(!found){
+		// Measure without holding the lock; the font itself is only read
+		box = font.getStringBoundingBox(str, 0, 0);
+
+		std::lock_guard<std::mutex> lock(boxesMtx);
+		if(boxes.size() >= maxBoxes)
+			boxes.clear();
+		boxes[str] = box;
+	}
+
+	box.x += x;
+	box.y += y;
+	return box;
+}//====================================================
@@ -0,0 +1,75 @@
+/**
+ * @file ofxPlotFont.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ *  @brief A loaded font that can be shared by many widgets
+ *  @details Passing an ofTrueTypeFont by value gives every widget its own
+ *  copy of the glyph atlas. Instead, getShared() loads each face and size
+ *  once and hands the same font, and so the same atlas texture, to every
+ *  widget that asks for it; the font is released when the last widget lets
+ *  go of it. String bounding boxes are memoized, so labels that are drawn
+ *  every frame are only measured once.
+ * 
+ *  Strings may be measured from any thread, e.g., while plots are exported
+ *  in parallel; drawing and changing the font must happen on the render
+ *  thread.
+ */
+class ofxPlotFont{
+public:
+	ofxPlotFont();
+	ofxPlotFont(const ofTrueTypeFont&);
+
+	static std::shared_ptr<ofxPlotFont> getShared(const std::string&, int);
+
+	void drawString(const std::string&, float, float) const;
+	ofRectangle getStringBoundingBox(const std::string&, float, float) const;
+
+	const ofTrueTypeFont& getFont() const;
+	float getLineHeight() const;
+	size_t getMemoryUsage() const;
+	bool isLoaded() const;
+	void setLetterSpacing(float);
+	void setLineHeight(float);
+
+protected:
+	ofTrueTypeFont font;		//!< The loaded font
+
+	mutable std::unordered_map<std::string, ofRectangle> boxes;	//!< Bounding boxes of measured strings, drawn at (0,0)
+	mutable std::mutex boxesMtx;	//!< Guards boxes, which threads measuring strings share
+
+	/** Most bounding boxes to remember; the memo is cleared when it fills, e.g., by ever-changing values */
+	static const size_t maxBoxes = 512;
+};
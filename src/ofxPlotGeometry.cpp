@@ -0,0 +1,255 @@
+/**
+ * @file ofxPlotGeometry.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotGeometry.hpp"
+
+#include "ofxPlotDecimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//-----------------------------------------------------------------------------
+// -- Build --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Build the geometry for a data snapshot
+ *  @details This does not touch OpenGL or any plot state and may run on any
+ *  thread. The cost is a few linear passes over the snapshot.
+ * 
+ *  @param in data snapshot and transform
+ *  @return the completed geometry
+ */
+std::shared_ptr<const ofxPlotGeometry> ofxPlotGeometry::build(const Input &in){
+	std::shared_ptr<ofxPlotGeometry> geom = std::make_shared<ofxPlotGeometry>();
+	geom->plotArea = in.plotArea;
+	geom->xScale = in.xScale;
+	geom->yScale = in.yScale;
+	geom->dataOrigin = in.dataOrigin;
+	geom->dataVersion = in.dataVersion;
+
+	geom->cols = std::max(1, (int)std::ceil(in.plotArea.width/cellSize));
+	geom->rows = std::max(1, (int)std::ceil(in.plotArea.height/cellSize));
+
+	size_t n = in.data.size();
+	geom->lines.resize(n);
+	geom->fills.resize(n);
+	geom->indices.resize(n);
+	for(size_t s = 0; s < n; s++){
+		const std::vector<dataPt> &data = *in.data[s];
+		ofxPlotDecimator decimator;
+		decimator.reset(in.dataOrigin, in.xScale, in.yScale);
+		decimator.add(data, data.size());
+		decimator.finish();
+		geom->lines[s] = decimator.getLine();
+		geom->buildIndex(data, geom->indices[s]);
+
+		if(s < in.fill.size() && in.fill[s]){
+			// Fill between the line and the horizontal axis (dependent variable = 0)
+			const std::vector<ofVec3f> &line = geom->lines[s];
+			std::vector<ofVec3f> &fill = geom->fills[s];
+			fill.reserve(2*line.size());
+			for(size_t i = 0; i < line.size(); i++){
+				fill.push_back(line[i]);
+				fill.push_back(ofVec3f(line[i].x, in.dataOrigin.y, 0));
+			}
+		}
+	}
+
+	return geom;
+}//====================================================
+
+/**
+ *  @brief Build the spatial index for a series
+ *  @details Points are counted per cell, then placed, so the index is built
+ *  in two linear passes with no per-cell allocations
+ * 
+ *  @param data data points
+ *  @param index spatial index to fill
+ */
+void ofxPlotGeometry::buildIndex(const std::vector<dataPt> &data, Index &index) const{
+	index.cellStart.assign(cols*rows + 1, 0);
+	for(size_t i = 0; i < data.size(); i++){
+		index.cellStart[cellOf(toScreen(data[i])) + 1]++;
+	}
+
+	for(size_t c = 1; c < index.cellStart.size(); c++){
+		index.cellStart[c] += index.cellStart[c - 1];
+	}
+
+	std::vector<uint32_t> next(index.cellStart.begin(), index.cellStart.end() - 1);
+	index.ixs.resize(data.size());
+	for(size_t i = 0; i < data.size(); i++){
+		index.ixs[next[cellOf(toScreen(data[i]))]++] = (uint32_t)i;
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Queries --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Find the points of a series that may lie within a region
+ *  @details The region is given in data coordinates so that queries remain
+ *  valid after the plot's transform has changed. The result may contain
+ *  points just outside the region; callers must test each point.
+ * 
+ *  @param s index of the series
+ *  @param lo minimum data values of the region
+ *  @param hi maximum data values of the region
+ *  @param ixs indices of the candidate points, in ascending order; cleared first
+ */
+void ofxPlotGeometry::query(size_t s, const dataPt &lo, const dataPt &hi, std::vector<size_t> &ixs) const{
+	ixs.clear();
+	if(s >= indices.size() || lo.indVar > hi.indVar || lo.depVar > hi.depVar)
+		return;
+
+	// The vertical axis points down in screen coordinates
+	ofVec2f topLeft = toScreen(dataPt(lo.indVar, hi.depVar));
+	ofVec2f botRight = toScreen(dataPt(hi.indVar, lo.depVar));
+	if(botRight.x < plotArea.x - cellSize || topLeft.x > plotArea.x + plotArea.width + cellSize ||
+		botRight.y < plotArea.y - cellSize || topLeft.y > plotArea.y + plotArea.height + cellSize){
+		return;
+	}
+
+	size_t c0 = cellOf(topLeft), c1 = cellOf(botRight);
+	int col0 = c0 % cols, row0 = c0 / cols;
+	int col1 = c1 % cols, row1 = c1 / cols;
+
+	const Index &index = indices[s];
+	for(int r = row0; r <= row1; r++){
+		for(int c = col0; c <= col1; c++){
+			size_t cell = r*cols + c;
+			ixs.insert(ixs.end(), index.ixs.begin() + index.cellStart[cell],
+				index.ixs.begin() + index.cellStart[cell + 1]);
+		}
+	}
+
+	std::sort(ixs.begin(), ixs.end());
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the version of the data the geometry was built from
+ *  @return the data version
+ */
+uint64_t ofxPlotGeometry::getDataVersion() const { return dataVersion; }
+
+/**
+ *  @brief Retrieve the number of series in the geometry
+ *  @return the number of series
+ */
+size_t ofxPlotGeometry::getNumSeries() const { return lines.size(); }
+
+/**
+ *  @brief Retrieve the number of points of a series that are in the index
+ *  @details Points added to the plot after the snapshot was taken are not
+ *  indexed, and must be searched separately
+ * 
+ *  @param s index of the series
+ *  @return the number of indexed points
+ */
+size_t ofxPlotGeometry::getNumIndexed(size_t s) const{
+	return s < indices.size() ? indices[s].ixs.size() : 0;
+}//====================================================
+
+/**
+ *  @brief Retrieve the fill strip for a series
+ *  @param s index of the series; must be less than getNumSeries()
+ *  @return the triangle strip vertices, screen coordinates; empty if the
+ *  series is not filled
+ */
+const std::vector<ofVec3f>& ofxPlotGeometry::getFill(size_t s) const { return fills[s]; }
+
+/**
+ *  @brief Retrieve the decimated line strip for a series
+ *  @param s index of the series; must be less than getNumSeries()
+ *  @return the line strip vertices, screen coordinates
+ */
+const std::vector<ofVec3f>& ofxPlotGeometry::getLine(size_t s) const { return lines[s]; }
+
+/**
+ *  @brief Retrieve the number of bytes allocated for the geometry and index
+ *  @details The data snapshot the geometry was built from is not included
+ *  @return the number of bytes
+ */
+size_t ofxPlotGeometry::getMemoryUsage() const{
+	size_t bytes = 0;
+	for(size_t s = 0; s < lines.size(); s++){
+		bytes += lines[s].capacity()*sizeof(ofVec3f) + fills[s].capacity()*sizeof(ofVec3f);
+	}
+	for(size_t s = 0; s < indices.size(); s++){
+		bytes += (indices[s].cellStart.capacity() + indices[s].ixs.capacity())*sizeof(uint32_t);
+	}
+	return bytes;
+}//====================================================
+
+/**
+ *  @brief Determine whether the geometry was built with a transform
+ * 
+ *  @param area plot area, screen coordinates
+ *  @param xs horizontal scaling, pixels per data unit
+ *  @param ys vertical scaling, pixels per data unit
+ *  @param origin location of the data origin, screen coordinates
+ *  @return whether or not the geometry's transform matches
+ */
+bool ofxPlotGeometry::hasTransform(const ofRectangle &area, double xs, double ys, const ofVec2f &origin) const{
+	return area == plotArea && xs == xScale && ys == yScale && origin == dataOrigin;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Utility --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Locate the grid cell that contains a point
+ *  @details Points outside the plot area are placed in the nearest cell
+ * 
+ *  @param pt location, screen coordinates
+ *  @return the row-major index of the cell
+ */
+size_t ofxPlotGeometry::cellOf(const ofVec2f &pt) const{
+	int c = (int)std::floor((pt.x - plotArea.x)/cellSize);
+	int r = (int)std::floor((pt.y - plotArea.y)/cellSize);
+	c = std::min(std::max(c, 0), cols - 1);
+	r = std::min(std::max(r, 0), rows - 1);
+	return r*cols + c;
+}//====================================================
+
+/**
+ *  @brief Transform a data point into screen coordinates with the
+ *  geometry's transform
+ * 
+ *  @param pt data point
+ *  @return the location of the data point, screen coordinates
+ */
+ofVec2f ofxPlotGeometry::toScreen(const dataPt &pt) const{
+	return ofVec2f(dataOrigin.x + xScale*pt.indVar, dataOrigin.y - yScale*pt.depVar);
+}//====================================================
@@ -0,0 +1,112 @@
+/**
+ * @file ofxPlotGeometry.hpp
+ * @brief Screen-space line geometry and spatial index, built from a data snapshot
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "dataPt.hpp"
+
+#include "ofMain.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ *  @brief Immutable screen-space geometry for the line style, built away
+ *  from the render thread
+ *  @details The geometry is built from a snapshot of the data and a fixed
+ *  transform, and is never modified afterwards, so it may be built on one
+ *  thread and then read by another without locking. It contains:
+ *  - a decimated line strip per series, with at most four vertices per pixel
+ *  column (see ofxPlotDecimator);
+ *  - a fill strip per filled series, between the decimated line and the
+ *  horizontal axis;
+ *  - a uniform grid over the plot area that lists the points in each cell,
+ *  used to answer hover and rectangle selection queries without visiting
+ *  every point.
+ */
+class ofxPlotGeometry{
+public:
+	/**
+	 *  @brief Everything required to build the geometry
+	 *  @details The data are shared with the plot, which must not modify them
+	 *  while the build holds them
+	 */
+	struct Input{
+		std::vector<std::shared_ptr<const std::vector<dataPt> > > data;	//!< Data snapshot, one per series
+		std::vector<bool> fill;					//!< Whether or not each series is filled
+		ofRectangle plotArea;					//!< Area within the axes, screen coordinates
+		double xScale = 1;						//!< Horizontal scaling, pixels per data unit
+		double yScale = 1;						//!< Vertical scaling, pixels per data unit
+		ofVec2f dataOrigin;						//!< Location of the data origin, screen coordinates
+		uint64_t dataVersion = 0;				//!< Identifies the state of the data the snapshot was taken from
+	};
+
+	static std::shared_ptr<const ofxPlotGeometry> build(const Input&);
+
+	uint64_t getDataVersion() const;
+	size_t getNumSeries() const;
+	size_t getNumIndexed(size_t) const;
+	const std::vector<ofVec3f>& getFill(size_t) const;
+	const std::vector<ofVec3f>& getLine(size_t) const;
+	size_t getMemoryUsage() const;
+	bool hasTransform(const ofRectangle&, double, double, const ofVec2f&) const;
+
+	void query(size_t, const dataPt&, const dataPt&, std::vector<size_t>&) const;
+
+protected:
+	/**
+	 *  @brief Grid of point indices for a single series
+	 *  @details Stored in compressed form: the indices of the points in cell c
+	 *  are ixs[cellStart[c]] through ixs[cellStart[c + 1] - 1]
+	 */
+	struct Index{
+		std::vector<uint32_t> cellStart;	//!< Offset of each cell's first entry in ixs, plus the total
+		std::vector<uint32_t> ixs;			//!< Point indices, grouped by cell
+	};
+
+	ofRectangle plotArea;				//!< Area within the axes, screen coordinates
+	double xScale = 1;					//!< Horizontal scaling, pixels per data unit
+	double yScale = 1;					//!< Vertical scaling, pixels per data unit
+	ofVec2f dataOrigin;					//!< Location of the data origin, screen coordinates
+	uint64_t dataVersion = 0;			//!< Identifies the state of the data the geometry was built from
+
+	std::vector<std::vector<ofVec3f> > lines;	//!< Decimated line strip for each series
+	std::vector<std::vector<ofVec3f> > fills;	//!< Fill strip for each series; empty if not filled
+	std::vector<Index> indices;					//!< Spatial index for each series
+
+	int cols = 0;						//!< Number of grid cells in the horizontal direction
+	int rows = 0;						//!< Number of grid cells in the vertical direction
+
+	/** Width and height of a grid cell, pixels */
+	static const int cellSize = 8;
+
+	size_t cellOf(const ofVec2f&) const;
+	void buildIndex(const std::vector<dataPt>&, Index&) const;
+	ofVec2f toScreen(const dataPt&) const;
+};
@@ -0,0 +1,231 @@
+/**
+ * @file ofxPlotGrid.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotGrid.hpp"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an empty grid
+ *  @details The grid routes input to its children and ignores it otherwise
+ */
+ofxPlotGrid::ofxPlotGrid(){
+	disableMouseInput();
+	disableKeyInput();
+	children.setBatched(true);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Graphics & Event Loop --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Draw the children in a single batched pass
+ */
+void ofxPlotGrid::draw(){
+	bNeedsRedraw = false;
+	children.draw();
+}//====================================================
+
+/**
+ *  @brief Prepare the grid to be drawn
+ *  @details The children are prepared by update(), so there is nothing left
+ *  to do
+ */
+void ofxPlotGrid::prepare(){}
+
+/**
+ *  @brief Update the children, then prepare them in parallel
+ *  @see ofxPlotContainer::update()
+ */
+void ofxPlotGrid::update(){
+	children.update();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add a child to the next cell of the grid
+ *  @details The child is resized to fit the cell and its mouse events are
+ *  routed through the grid's dispatcher
+ *  @param obj pointer to the child; ignored if it is already in the grid
+ */
+void ofxPlotGrid::add(InteractiveObj *obj){
+	if(!obj || obj == this)
+		return;
+
+	size_t n = children.getNumObjects();
+	children.add(obj);
+	if(children.getNumObjects() == n)
+		return;
+
+	dispatcher.add(obj);
+	layout();
+}//====================================================
+
+/**
+ *  @brief Remove a child from the grid
+ *  @details The remaining children move up to fill the gap. The removed
+ *  child keeps its position and size, and listens to the global mouse
+ *  events again.
+ *  @param obj pointer to the child
+ */
+void ofxPlotGrid::remove(InteractiveObj *obj){
+	children.remove(obj);
+	dispatcher.remove(obj);
+	layout();
+}//====================================================
+
+/**
+ *  @brief Remove all children from the grid
+ */
+void ofxPlotGrid::clear(){
+	for(size_t i = 0; i < children.getNumObjects(); i++){
+		dispatcher.remove(children.getObject(i));
+	}
+	children.clear();
+	requestRedraw();
+}//====================================================
+
+/**
+ *  @brief Retrieve the container that holds the children
+ *  @details Use getContainer().getBatch().getNumDrawCalls() to see how many
+ *  draw calls the batched children cost
+ *  @return the container
+ */
+const ofxPlotContainer& ofxPlotGrid::getContainer() const { return children; }
+
+/**
+ *  @brief Retrieve the bytes held by the grid and its children
+ *  @return the buffers held by the grid and its children
+ */
+ofxPlotMemory ofxPlotGrid::getMemoryUsage() const{
+	ofxPlotMemory mem = InteractiveObj::getMemoryUsage();
+	mem.add("", children.getMemoryUsage());
+	return mem;
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of children per row
+ *  @return the number of children per row
+ */
+size_t ofxPlotGrid::getNumColumns() const { return numColumns; }
+
+/**
+ *  @brief Retrieve the number of rows that hold children
+ *  @return the number of rows
+ */
+size_t ofxPlotGrid::getNumRows() const{
+	return (children.getNumObjects() + numColumns - 1)/numColumns;
+}//====================================================
+
+/**
+ *  @brief Determine whether any child must be redrawn
+ *  @return whether or not the grid or any of its children have changed
+ *  since the last draw
+ */
+bool ofxPlotGrid::needsRedraw() const{
+	if(InteractiveObj::needsRedraw())
+		return true;
+
+	for(size_t i = 0; i < children.getNumObjects(); i++){
+		if(children.getObject(i)->needsRedraw())
+			return true;
+	}
+	return false;
+}//====================================================
+
+/**
+ *  @brief Set the number of children per row
+ *  @param n number of children per row; values below one are treated as one
+ */
+void ofxPlotGrid::setNumColumns(size_t n){
+	numColumns = std::max<size_t>(n, 1);
+	layout();
+}//====================================================
+
+/**
+ *  @brief Move the grid and its children
+ *  @param x horizontal coordinate of the top-left corner, pixels
+ *  @param y vertical coordinate of the top-left corner, pixels
+ */
+void ofxPlotGrid::setPosition(float x, float y){
+	InteractiveObj::setPosition(x, y);
+	layout();
+}//====================================================
+
+/**
+ *  @brief Resize the grid and its children
+ *  @param w width, pixels
+ *  @param h height, pixels
+ */
+void ofxPlotGrid::setSize(float w, float h){
+	InteractiveObj::setSize(w, h);
+	layout();
+}//====================================================
+
+/**
+ *  @brief Set the gap between neighboring cells
+ *  @param s gap, pixels
+ */
+void ofxPlotGrid::setSpacing(float s){
+	spacing = std::max(s, 0.f);
+	layout();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Miscellaneous --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Place each child in its cell
+ *  @details The cells divide the grid's viewport evenly between the columns
+ *  and the rows that are in use
+ */
+void ofxPlotGrid::layout(){
+	size_t n = children.getNumObjects();
+	size_t rows = getNumRows();
+	if(n == 0 || rows == 0)
+		return;
+
+	float cellW = std::max((viewport.width - spacing*(numColumns - 1))/numColumns, 1.f);
+	float cellH = std::max((viewport.height - spacing*(rows - 1))/rows, 1.f);
+
+	for(size_t i = 0; i < n; i++){
+		size_t row = i/numColumns, col = i % numColumns;
+		InteractiveObj *obj = children.getObject(i);
+		obj->setPosition(viewport.x + col*(cellW + spacing), viewport.y + row*(cellH + spacing));
+		obj->setSize(cellW, cellH);
+	}
+	requestRedraw();
+}//====================================================
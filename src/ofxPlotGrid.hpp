@@ -0,0 +1,80 @@
+/**
+ * @file ofxPlotGrid.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "interactiveObj.hpp"
+#include "ofxPlotContainer.hpp"
+#include "ofxPlotDispatcher.hpp"
+
+#include "ofMain.h"
+
+/**
+ *  @brief Lays out child objects in a grid and draws them in one batched pass
+ *  @details Children fill the grid row by row, in the order they are added,
+ *  and are resized whenever the grid is moved or resized. The children are
+ *  updated and prepared by an ofxPlotContainer with batching enabled, so the
+ *  backgrounds, axes, lines, and text of every child are merged into a few
+ *  draw calls (see ofxPlotBatch). Mouse events are routed to the children by
+ *  an ofxPlotDispatcher that the grid owns; the grid itself does not respond
+ *  to input.
+ * 
+ *  The grid does not own the children; they must remain in scope until they
+ *  are removed or the grid is destroyed.
+ */
+class ofxPlotGrid : public InteractiveObj{
+public:
+	ofxPlotGrid();
+
+	void update();
+	void prepare();
+	void draw();
+
+	void add(InteractiveObj*);
+	void remove(InteractiveObj*);
+	void clear();
+
+	const ofxPlotContainer& getContainer() const;
+	ofxPlotMemory getMemoryUsage() const;
+	size_t getNumColumns() const;
+	size_t getNumRows() const;
+	bool needsRedraw() const;
+
+	void setNumColumns(size_t);
+	void setPosition(float, float);
+	void setSize(float, float);
+	void setSpacing(float);
+
+protected:
+	ofxPlotContainer children;		//!< Updates, prepares, and batches the children
+	ofxPlotDispatcher dispatcher;	//!< Routes mouse events to the children
+
+	size_t numColumns = 4;			//!< Number of children per row
+	float spacing = 10;				//!< Gap between neighboring cells, pixels
+
+	void layout();
+};
@@ -0,0 +1,464 @@
+/**
+ * @file ofxPlotInputRecording.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotInputRecording.hpp"
+
+#include "interactiveObj.hpp"
+#include "ofxPlotDispatcher.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+//-----------------------------------------------------------------------------
+// -- Report --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Record the time spent handling an event
+ *  @param type kind of event
+ *  @param ns time spent handling the event, nanoseconds
+ */
+void ofxPlotInputRecording::Report::add(Type type, uint64_t ns){
+	latencies[type].push_back(ns);
+}//====================================================
+
+/**
+ *  @brief Sort the latencies so that percentiles can be computed
+ *  @details Called by replay() once all events have been handled
+ */
+void ofxPlotInputRecording::Report::finish(){
+	for(int t = 0; t < NUM_TYPES; t++){
+		std::sort(latencies[t].begin(), latencies[t].end());
+	}
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of events of a type that were replayed
+ *  @param type kind of event
+ *  @return the number of events
+ */
+size_t ofxPlotInputRecording::Report::getCount(Type type) const { return latencies[type].size(); }
+
+/**
+ *  @brief Retrieve the time spent handling each event of a type
+ *  @param type kind of event
+ *  @return the latencies, nanoseconds, in ascending order
+ */
+const std::vector<uint64_t>& ofxPlotInputRecording::Report::getLatencies(Type type) const { return latencies[type]; }
+
+/**
+ *  @brief Compute a percentile of the time spent handling events of a type
+ *  @details Uses the nearest-rank method, so the result is always one of
+ *  the measured latencies
+ * 
+ *  @param type kind of event
+ *  @param p percentile, between 0 and 100; 100 gives the maximum
+ *  @return the latency, microseconds; zero if no events of the type were replayed
+ */
+double ofxPlotInputRecording::Report::getPercentile(Type type, double p) const{
+	const std::vector<uint64_t> &lat = latencies[type];
+	if(lat.empty())
+		return 0;
+
+	p = std::min(std::max(p, 0.0), 100.0);
+	size_t rank = (size_t)std::ceil(p/100*lat.size());
+	return lat[rank > 0 ? rank - 1 : 0]/1000.0;
+}//====================================================
+
+/**
+ *  @brief Summarize the latencies as a table, one row per event type
+ *  @return the summary; latencies are in microseconds
+ */
+std::string ofxPlotInputRecording::Report::toString() const{
+	std::ostringstream out;
+	char buf[160];
+	snprintf(buf, sizeof(buf), "%-14s %8s %10s %10s %10s %10s\n", "event", "count", "p50 us", "p90 us", "p99 us", "max us");
+	out << buf;
+
+	for(int t = 0; t < NUM_TYPES; t++){
+		Type type = (Type)t;
+		if(latencies[t].empty())
+			continue;
+
+		snprintf(buf, sizeof(buf), "%-14s %8zu %10.2f %10.2f %10.2f %10.2f\n", getName(type).c_str(),
+			latencies[t].size(), getPercentile(type, 50), getPercentile(type, 90),
+			getPercentile(type, 99), getPercentile(type, 100));
+		out << buf;
+	}
+	return out.str();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an empty recording
+ */
+ofxPlotInputRecording::ofxPlotInputRecording(){}
+
+/**
+ *  @brief Stop recording, if necessary
+ */
+ofxPlotInputRecording::~ofxPlotInputRecording(){
+	stop();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Record --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Discard all recorded events
+ */
+void ofxPlotInputRecording::clear(){
+	events.clear();
+	startOffset = 0;
+	startTime = std::chrono::steady_clock::now();
+}//====================================================
+
+/**
+ *  @brief Determine whether or not events are being recorded
+ *  @return whether or not events are being recorded
+ */
+bool ofxPlotInputRecording::isRecording() const { return bRecording; }
+
+/**
+ *  @brief Begin recording the global mouse and key events
+ *  @details Events are appended to any that were already recorded; call
+ *  clear() first to begin a new recording. The time between stop() and
+ *  start() is not recorded.
+ */
+void ofxPlotInputRecording::start(){
+	if(bRecording)
+		return;
+
+	startOffset = events.empty() ? 0 : events.back().time;
+	startTime = std::chrono::steady_clock::now();
+
+	ofCoreEvents &evts = ofEvents();
+	ofAddListener(evts.update, this, &ofxPlotInputRecording::frameStarted, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(evts.mouseMoved, this, &ofxPlotInputRecording::mouseMoved, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(evts.mousePressed, this, &ofxPlotInputRecording::mousePressed, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(evts.mouseReleased, this, &ofxPlotInputRecording::mouseReleased, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(evts.mouseDragged, this, &ofxPlotInputRecording::mouseDragged, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(evts.keyPressed, this, &ofxPlotInputRecording::keyPressed, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(evts.keyReleased, this, &ofxPlotInputRecording::keyReleased, OF_EVENT_ORDER_BEFORE_APP);
+	bRecording = true;
+}//====================================================
+
+/**
+ *  @brief Stop recording; the recorded events are kept
+ */
+void ofxPlotInputRecording::stop(){
+	if(!bRecording)
+		return;
+
+	ofCoreEvents &evts = ofEvents();
+	ofRemoveListener(evts.update, this, &ofxPlotInputRecording::frameStarted, OF_EVENT_ORDER_BEFORE_APP);
+	ofRemoveListener(evts.mouseMoved, this, &ofxPlotInputRecording::mouseMoved, OF_EVENT_ORDER_BEFORE_APP);
+	ofRemoveListener(evts.mousePressed, this, &ofxPlotInputRecording::mousePressed, OF_EVENT_ORDER_BEFORE_APP);
+	ofRemoveListener(evts.mouseReleased, this, &ofxPlotInputRecording::mouseReleased, OF_EVENT_ORDER_BEFORE_APP);
+	ofRemoveListener(evts.mouseDragged, this, &ofxPlotInputRecording::mouseDragged, OF_EVENT_ORDER_BEFORE_APP);
+	ofRemoveListener(evts.keyPressed, this, &ofxPlotInputRecording::keyPressed, OF_EVENT_ORDER_BEFORE_APP);
+	ofRemoveListener(evts.keyReleased, this, &ofxPlotInputRecording::keyReleased, OF_EVENT_ORDER_BEFORE_APP);
+	bRecording = false;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- File I/O --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Replace the recorded events with those stored in a file
+ *  @param path file to read, relative to the data directory
+ *  @return whether or not the file was read; if not, the recording is unchanged
+ *  @see save()
+ */
+bool ofxPlotInputRecording::load(const std::string &path){
+	std::ifstream in(ofToDataPath(path).c_str());
+	if(!in){
+		ofLogWarning("ofxPlotInputRecording") << "load: could not open " << path;
+		return false;
+	}
+
+	std::vector<Event> loaded;
+	std::string line;
+	for(size_t lineNum = 1; std::getline(in, line); lineNum++){
+		if(line.empty() || line[0] == '#')
+			continue;
+
+		std::istringstream fields(line);
+		std::string name;
+		Event e;
+		if(!(fields >> name >> e.time >> e.x >> e.y >> e.button >> e.key)){
+			ofLogWarning("ofxPlotInputRecording") << "load: " << path << ":" << lineNum << " is malformed";
+			return false;
+		}
+
+		int t = 0;
+		while(t < NUM_TYPES && getName((Type)t) != name){ t++; }
+		if(t == NUM_TYPES){
+			ofLogWarning("ofxPlotInputRecording") << "load: " << path << ":" << lineNum << " has unknown event " << name;
+			return false;
+		}
+
+		e.type = (Type)t;
+		loaded.push_back(e);
+	}
+
+	stop();
+	events.swap(loaded);
+	return true;
+}//====================================================
+
+/**
+ *  @brief Write the recorded events to a file
+ *  @details The file is plain text with one event per line: the event name,
+ *  time in microseconds, mouse x and y, mouse button, and key code. Lines
+ *  that begin with '#' are comments.
+ * 
+ *  @param path file to write, relative to the data directory
+ *  @return whether or not the file was written
+ */
+bool ofxPlotInputRecording::save(const std::string &path) const{
+	std::ofstream out(ofToDataPath(path).c_str());
+	if(!out){
+		ofLogWarning("ofxPlotInputRecording") << "save: could not open " << path;
+		return false;
+	}
+
+	out << "# ofxPlotInputRecording: event time_us x y button key\n";
+	for(size_t i = 0; i < events.size(); i++){
+		const Event &e = events[i];
+		out << getName(e.type) << " " << e.time << " " << e.x << " " << e.y << " " << e.button << " " << e.key << "\n";
+	}
+	return (bool)out;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Replay --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Deliver the recorded events to a set of objects and time how long
+ *  each event takes to handle
+ *  @details Events are delivered in order, without waiting between them.
+ *  Key events and frame markers go to every object; a frame marker calls
+ *  update(). Mouse events go to every object, or, if a dispatcher is given,
+ *  through the dispatcher so that only the objects beneath the cursor
+ *  receive them, as they would in an application that uses one. Objects
+ *  that own other objects (e.g., the limiters of an ofxPlotCtrl) only pass
+ *  mouse events to them through a dispatcher. Objects do not need mouse or
+ *  key input enabled unless they are reached through the dispatcher.
+ * 
+ *  @param objs objects to deliver the events to
+ *  @param dispatcher dispatcher to route the mouse events through; nullptr
+ *  to deliver them to every object
+ *  @return the time spent handling each event
+ */
+ofxPlotInputRecording::Report ofxPlotInputRecording::replay(const std::vector<InteractiveObj*> &objs,
+	ofxPlotDispatcher *dispatcher) const{
+
+	Report report;
+	for(size_t i = 0; i < events.size(); i++){
+		const Event &e = events[i];
+		ofMouseEventArgs mouse;
+		mouse.x = e.x;
+		mouse.y = e.y;
+		mouse.button = e.button;
+		ofKeyEventArgs key;
+		key.key = e.key;
+		key.keycode = e.key;
+
+		std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+		switch(e.type){
+			case MOUSE_MOVED:
+				mouse.type = ofMouseEventArgs::Moved;
+				if(dispatcher)
+					dispatcher->mouseMoved(mouse);
+				else
+					for(size_t o = 0; o < objs.size(); o++){ objs[o]->mouseMoved(mouse); }
+				break;
+			case MOUSE_PRESSED:
+				mouse.type = ofMouseEventArgs::Pressed;
+				if(dispatcher)
+					dispatcher->mousePressed(mouse);
+				else
+					for(size_t o = 0; o < objs.size(); o++){ objs[o]->mousePressed(mouse); }
+				break;
+			case MOUSE_RELEASED:
+				mouse.type = ofMouseEventArgs::Released;
+				if(dispatcher)
+					dispatcher->mouseReleased(mouse);
+				else
+					for(size_t o = 0; o < objs.size(); o++){ objs[o]->mouseReleased(mouse); }
+				break;
+			case MOUSE_DRAGGED:
+				mouse.type = ofMouseEventArgs::Dragged;
+				if(dispatcher)
+					dispatcher->mouseDragged(mouse);
+				else
+					for(size_t o = 0; o < objs.size(); o++){ objs[o]->mouseDragged(mouse); }
+				break;
+			case KEY_PRESSED:
+				key.type = ofKeyEventArgs::Pressed;
+				for(size_t o = 0; o < objs.size(); o++){ objs[o]->keyPressed(key); }
+				break;
+			case KEY_RELEASED:
+				key.type = ofKeyEventArgs::Released;
+				for(size_t o = 0; o < objs.size(); o++){ objs[o]->keyReleased(key); }
+				break;
+			case FRAME:
+				for(size_t o = 0; o < objs.size(); o++){ objs[o]->update(); }
+				break;
+			default:
+				break;
+		}
+		std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - t0;
+		report.add(e.type, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+	}
+
+	report.finish();
+	return report;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the recorded events
+ *  @return the events, in the order they occurred
+ */
+const std::vector<ofxPlotInputRecording::Event>& ofxPlotInputRecording::getEvents() const { return events; }
+
+/**
+ *  @brief Retrieve the name of an event type, as used in recording files
+ *  @param type kind of event
+ *  @return the name
+ */
+std::string ofxPlotInputRecording::getName(Type type){
+	switch(type){
+		case MOUSE_MOVED: return "mouseMoved";
+		case MOUSE_PRESSED: return "mousePressed";
+		case MOUSE_RELEASED: return "mouseReleased";
+		case MOUSE_DRAGGED: return "mouseDragged";
+		case KEY_PRESSED: return "keyPressed";
+		case KEY_RELEASED: return "keyReleased";
+		case FRAME: return "frame";
+		default: return "unknown";
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Event Handlers --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Record the start of a frame
+ */
+void ofxPlotInputRecording::frameStarted(ofEventArgs&){
+	record(FRAME, 0, 0, 0, 0);
+}//====================================================
+
+/**
+ *  @brief Record a keyPressed event
+ *  @param evt A set of arguments that describe the keyPressed event
+ */
+void ofxPlotInputRecording::keyPressed(ofKeyEventArgs &evt){
+	record(KEY_PRESSED, 0, 0, 0, evt.key);
+}//====================================================
+
+/**
+ *  @brief Record a keyReleased event
+ *  @param evt A set of arguments that describe the keyReleased event
+ */
+void ofxPlotInputRecording::keyReleased(ofKeyEventArgs &evt){
+	record(KEY_RELEASED, 0, 0, 0, evt.key);
+}//====================================================
+
+/**
+ *  @brief Record a mouseDragged event
+ *  @param mouse a set of arguments that describes the mouseDragged event
+ */
+void ofxPlotInputRecording::mouseDragged(ofMouseEventArgs &mouse){
+	record(MOUSE_DRAGGED, mouse.x, mouse.y, mouse.button, 0);
+}//====================================================
+
+/**
+ *  @brief Record a mouseMoved event
+ *  @param mouse a set of arguments that describes the mouseMoved event
+ */
+void ofxPlotInputRecording::mouseMoved(ofMouseEventArgs &mouse){
+	record(MOUSE_MOVED, mouse.x, mouse.y, mouse.button, 0);
+}//====================================================
+
+/**
+ *  @brief Record a mousePressed event
+ *  @param mouse a set of arguments that describes the mousePressed event
+ */
+void ofxPlotInputRecording::mousePressed(ofMouseEventArgs &mouse){
+	record(MOUSE_PRESSED, mouse.x, mouse.y, mouse.button, 0);
+}//====================================================
+
+/**
+ *  @brief Record a mouseReleased event
+ *  @param mouse a set of arguments that describes the mouseReleased event
+ */
+void ofxPlotInputRecording::mouseReleased(ofMouseEventArgs &mouse){
+	record(MOUSE_RELEASED, mouse.x, mouse.y, mouse.button, 0);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Miscellaneous --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Append an event, stamped with the current time
+ * 
+ *  @param type kind of event
+ *  @param x mouse location, screen coordinates
+ *  @param y mouse location, screen coordinates
+ *  @param button mouse button
+ *  @param key key code
+ */
+void ofxPlotInputRecording::record(Type type, float x, float y, int button, int key){
+	std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - startTime;
+
+	Event e;
+	e.type = type;
+	e.time = startOffset + std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+	e.x = x;
+	e.y = y;
+	e.button = button;
+	e.key = key;
+	events.push_back(e);
+}//====================================================
@@ -0,0 +1,130 @@
+/**
+ * @file ofxPlotInputRecording.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Forward declarations
+class InteractiveObj;
+class ofxPlotDispatcher;
+
+/**
+ *  @brief Records mouse and keyboard input so that it can be replayed
+ *  @details While recording, the global mouse and key events are stored
+ *  with their times, along with a marker at the start of each frame's
+ *  update. A recording can be saved to and loaded from a text file, one
+ *  event per line, and replayed into a set of objects without a window: the
+ *  events are delivered to the objects' handlers in order, as fast as
+ *  possible, and each frame marker calls the objects' update() so that
+ *  input that is deferred to update() (e.g., ofxPlot::setCoalesceInput())
+ *  is processed at the same points it was when recorded. The time spent
+ *  handling each event is reported so that interaction latency can be
+ *  compared across builds and data sets.
+ */
+class ofxPlotInputRecording{
+public:
+	/**
+	 *  @brief Kinds of recorded events
+	 */
+	enum Type{
+		MOUSE_MOVED,		//!< Mouse moved with no button pressed
+		MOUSE_PRESSED,		//!< Mouse button pressed
+		MOUSE_RELEASED,		//!< Mouse button released
+		MOUSE_DRAGGED,		//!< Mouse moved with a button pressed
+		KEY_PRESSED,		//!< Key pressed
+		KEY_RELEASED,		//!< Key released
+		FRAME,				//!< Start of a frame's update
+		NUM_TYPES
+	};
+
+	/**
+	 *  @brief A single recorded event
+	 */
+	struct Event{
+		Type type = FRAME;		//!< Kind of event
+		uint64_t time = 0;		//!< Time since the recording started, microseconds
+		float x = 0;			//!< Mouse location, screen coordinates (mouse events only)
+		float y = 0;			//!< Mouse location, screen coordinates (mouse events only)
+		int button = 0;			//!< Mouse button (mouse events only)
+		int key = 0;			//!< Key code (key events only)
+	};
+
+	/**
+	 *  @brief Time spent handling each replayed event, grouped by type
+	 */
+	class Report{
+	public:
+		void add(Type, uint64_t);
+		void finish();
+
+		size_t getCount(Type) const;
+		const std::vector<uint64_t>& getLatencies(Type) const;
+		double getPercentile(Type, double) const;
+		std::string toString() const;
+
+	protected:
+		std::vector<uint64_t> latencies[NUM_TYPES];	//!< Time to handle each event, nanoseconds; sorted by finish()
+	};
+
+	ofxPlotInputRecording();
+	~ofxPlotInputRecording();
+
+	void clear();
+	bool isRecording() const;
+	void start();
+	void stop();
+
+	bool load(const std::string&);
+	bool save(const std::string&) const;
+
+	Report replay(const std::vector<InteractiveObj*>&, ofxPlotDispatcher* = nullptr) const;
+
+	const std::vector<Event>& getEvents() const;
+	static std::string getName(Type);
+
+	void frameStarted(ofEventArgs&);
+	void keyPressed(ofKeyEventArgs&);
+	void keyReleased(ofKeyEventArgs&);
+	void mouseDragged(ofMouseEventArgs&);
+	void mouseMoved(ofMouseEventArgs&);
+	void mousePressed(ofMouseEventArgs&);
+	void mouseReleased(ofMouseEventArgs&);
+
+protected:
+	std::vector<Event> events;		//!< Recorded events, in order
+	bool bRecording = false;		//!< Whether or not events are being recorded
+	std::chrono::steady_clock::time_point startTime;	//!< Time the recording started (or resumed)
+	uint64_t startOffset = 0;		//!< Time of the last event when the recording resumed, microseconds
+
+	void record(Type, float, float, int, int);
+};
@@ -0,0 +1,137 @@
+/**
+ * @file ofxPlotMemory.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotMemory.hpp"
+
+#include <cstdio>
+#include <sstream>
+
+//-----------------------------------------------------------------------------
+// -- Record --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add a buffer
+ *  @details Empty buffers are not listed
+ * 
+ *  @param name name of the buffer
+ *  @param bytes number of bytes the buffer holds
+ *  @param gpu whether the buffer is held by the GPU rather than in main memory
+ */
+void ofxPlotMemory::add(const std::string &name, size_t bytes, bool gpu){
+	if(bytes == 0)
+		return;
+
+	Entry e;
+	e.name = name;
+	e.bytes = bytes;
+	e.bGPU = gpu;
+	entries.push_back(e);
+
+	if(gpu)
+		gpuBytes += bytes;
+	else
+		cpuBytes += bytes;
+}//====================================================
+
+/**
+ *  @brief Add every buffer of another object, e.g., a child widget
+ * 
+ *  @param prefix prepended to the name of each buffer
+ *  @param other buffers to add
+ */
+void ofxPlotMemory::add(const std::string &prefix, const ofxPlotMemory &other){
+	for(size_t i = 0; i < other.entries.size(); i++){
+		add(prefix + other.entries[i].name, other.entries[i].bytes, other.entries[i].bGPU);
+	}
+}//====================================================
+
+/**
+ *  @brief Remove all buffers
+ */
+void ofxPlotMemory::clear(){
+	entries.clear();
+	cpuBytes = 0;
+	gpuBytes = 0;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the number of bytes held in main memory
+ *  @return the number of bytes
+ */
+size_t ofxPlotMemory::getCPU() const { return cpuBytes; }
+
+/**
+ *  @brief Retrieve the buffers
+ *  @return the buffers, in the order they were added
+ */
+const std::vector<ofxPlotMemory::Entry>& ofxPlotMemory::getEntries() const { return entries; }
+
+/**
+ *  @brief Retrieve the number of bytes held by the GPU
+ *  @return the number of bytes
+ */
+size_t ofxPlotMemory::getGPU() const { return gpuBytes; }
+
+/**
+ *  @brief Retrieve the number of bytes held in main memory and by the GPU
+ *  @return the number of bytes
+ */
+size_t ofxPlotMemory::getTotal() const { return cpuBytes + gpuBytes; }
+
+/**
+ *  @brief Retrieve the number of bytes held by a mesh
+ *  @details A VBO mesh holds the same amount again on the GPU once drawn
+ *  @param mesh mesh
+ *  @return the number of bytes used by the vertices, colors, and indices
+ */
+size_t ofxPlotMemory::bytesOf(const ofMesh &mesh){
+	return mesh.getNumVertices()*sizeof(ofVec3f) + mesh.getNumColors()*sizeof(ofFloatColor) +
+		mesh.getNumIndices()*sizeof(ofIndexType);
+}//====================================================
+
+/**
+ *  @brief List the buffers, one per line, followed by the totals
+ *  @return the list; sizes are in kilobytes
+ */
+std::string ofxPlotMemory::toString() const{
+	std::ostringstream out;
+	char buf[160];
+	for(size_t i = 0; i < entries.size(); i++){
+		snprintf(buf, sizeof(buf), "%-28s %12.1f kB%s\n", entries[i].name.c_str(),
+			entries[i].bytes/1024.0, entries[i].bGPU ? " (GPU)" : "");
+		out << buf;
+	}
+	snprintf(buf, sizeof(buf), "%-28s %12.1f kB\n%-28s %12.1f kB", "total (CPU)", cpuBytes/1024.0,
+		"total (GPU)", gpuBytes/1024.0);
+	out << buf;
+	return out.str();
+}//====================================================
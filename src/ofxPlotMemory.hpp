@@ -0,0 +1,87 @@
+/**
+ * @file ofxPlotMemory.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <string>
+#include <vector>
+
+/**
+ *  @brief Describes what a plot does when its memory cap is exceeded
+ *  @see ofxPlot::setMemoryCap()
+ */
+enum class ofxPlotMemoryPolicy{
+	EVICT_OLDEST,	//!< Remove the oldest (first) points of each series
+	DECIMATE		//!< Keep the minimum and maximum of each run of points, halving the resolution of each series
+};
+
+/**
+ *  @brief Bytes held by an object, broken down by buffer
+ *  @details Objects add an entry for each buffer they hold; GPU buffers are
+ *  flagged so that they can be reported separately. Sizes reflect the
+ *  capacity of each buffer, not just the part in use. Buffers whose size is
+ *  managed by openFrameworks (paths, fonts) are estimated.
+ *  @see InteractiveObj::getMemoryUsage()
+ */
+class ofxPlotMemory{
+public:
+	/**
+	 *  @brief A single buffer
+	 */
+	struct Entry{
+		std::string name = "";		//!< Name of the buffer
+		size_t bytes = 0;			//!< Bytes held by the buffer
+		bool bGPU = false;			//!< Whether the buffer is held by the GPU rather than in main memory
+	};
+
+	void add(const std::string&, size_t, bool = false);
+	void add(const std::string&, const ofxPlotMemory&);
+	void clear();
+
+	size_t getCPU() const;
+	const std::vector<Entry>& getEntries() const;
+	size_t getGPU() const;
+	size_t getTotal() const;
+	std::string toString() const;
+
+	/**
+	 *  @brief Retrieve the number of bytes allocated by a vector
+	 *  @param v vector
+	 *  @return the number of bytes, based on the vector's capacity
+	 */
+	template<typename T>
+	static size_t bytesOf(const std::vector<T> &v){ return v.capacity()*sizeof(T); }
+
+	static size_t bytesOf(const ofMesh&);
+
+protected:
+	std::vector<Entry> entries;		//!< Buffers, in the order they were added
+	size_t cpuBytes = 0;			//!< Bytes held in main memory, summed over all entries
+	size_t gpuBytes = 0;			//!< Bytes held by the GPU, summed over all entries
+};
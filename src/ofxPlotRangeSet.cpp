@@ -0,0 +1,322 @@
+/**
+ * @file ofxPlotRangeSet.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotRangeSet.hpp"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- Modify --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add a single index to the set
+ *  @param ix index
+ */
+void ofxPlotRangeSet::add(size_t ix){ add(ix, ix + 1); }
+
+/**
+ *  @brief Add a range of indices to the set
+ *  @details Any ranges that overlap or touch the new range are merged with it
+ * 
+ *  @param first first index in the range
+ *  @param last one past the final index in the range
+ */
+void ofxPlotRangeSet::add(size_t first, size_t last){
+	if(first >= last)
+		return;
+
+	// Locate the first range that ends at or after the new range begins
+	std::vector<range_t>::iterator it = std::lower_bound(ranges.begin(), ranges.end(), first,
+		[](const range_t &r, size_t val){ return r.second < val; });
+
+	// Absorb all ranges that overlap or touch the new range
+	std::vector<range_t>::iterator stop = it;
+	while(stop != ranges.end() && stop->first <= last){
+		first = std::min(first, stop->first);
+		last = std::max(last, stop->second);
+		++stop;
+	}
+
+	it = ranges.erase(it, stop);
+	ranges.insert(it, range_t(first, last));
+}//====================================================
+
+/**
+ *  @brief Add all indices in another set to this set
+ *  @param other set of indices
+ */
+void ofxPlotRangeSet::add(const ofxPlotRangeSet &other){
+	if(other.ranges.empty())
+		return;
+
+	if(ranges.empty()){
+		ranges = other.ranges;
+		return;
+	}
+
+	// Merge the two sorted lists, combining ranges that overlap or touch
+	std::vector<range_t> merged;
+	merged.reserve(ranges.size() + other.ranges.size());
+
+	size_t i = 0, j = 0;
+	while(i < ranges.size() || j < other.ranges.size()){
+		const range_t &r = (j == other.ranges.size() ||
+			(i < ranges.size() && ranges[i].first < other.ranges[j].first)) ? ranges[i++] : other.ranges[j++];
+
+		if(!merged.empty() && r.first <= merged.back().second)
+			merged.back().second = std::max(merged.back().second, r.second);
+		else
+			merged.push_back(r);
+	}
+
+	ranges.swap(merged);
+}//====================================================
+
+/**
+ *  @brief Remove all indices from the set
+ */
+void ofxPlotRangeSet::clear(){ ranges.clear(); }
+
+/**
+ *  @brief Remove all indices outside of a range
+ * 
+ *  @param first first index in the range to keep
+ *  @param last one past the final index in the range to keep
+ */
+void ofxPlotRangeSet::intersect(size_t first, size_t last){
+	if(first >= last){
+		ranges.clear();
+		return;
+	}
+
+	subtract(0, first);
+	subtract(last, static_cast<size_t>(-1));
+}//====================================================
+
+/**
+ *  @brief Remove all indices that are not also in another set
+ *  @param other set of indices
+ */
+void ofxPlotRangeSet::intersect(const ofxPlotRangeSet &other){
+	std::vector<range_t> common;
+
+	size_t i = 0, j = 0;
+	while(i < ranges.size() && j < other.ranges.size()){
+		size_t first = std::max(ranges[i].first, other.ranges[j].first);
+		size_t last = std::min(ranges[i].second, other.ranges[j].second);
+		if(first < last)
+			common.push_back(range_t(first, last));
+
+		// Advance whichever range ends first
+		if(ranges[i].second < other.ranges[j].second)
+			i++;
+		else
+			j++;
+	}
+
+	ranges.swap(common);
+}//====================================================
+
+/**
+ *  @brief Remove a range of indices from the set
+ * 
+ *  @param first first index in the range
+ *  @param last one past the final index in the range
+ */
+void ofxPlotRangeSet::subtract(size_t first, size_t last){
+	if(first >= last)
+		return;
+
+	// Locate the first range that ends after the removed range begins
+	std::vector<range_t>::iterator it = std::upper_bound(ranges.begin(), ranges.end(), first,
+		[](size_t val, const range_t &r){ return val < r.second; });
+
+	// Keep the portions of the overlapping ranges that lie outside the removed range
+	std::vector<range_t> keep;
+	std::vector<range_t>::iterator stop = it;
+	while(stop != ranges.end() && stop->first < last){
+		if(stop->first < first)
+			keep.push_back(range_t(stop->first, first));
+		if(stop->second > last)
+			keep.push_back(range_t(last, stop->second));
+		++stop;
+	}
+
+	it = ranges.erase(it, stop);
+	ranges.insert(it, keep.begin(), keep.end());
+}//====================================================
+
+/**
+ *  @brief Remove all indices in another set from this set
+ *  @param other set of indices
+ */
+void ofxPlotRangeSet::subtract(const ofxPlotRangeSet &other){
+	if(ranges.empty() || other.ranges.empty())
+		return;
+
+	std::vector<range_t> diff;
+
+	size_t j = 0;
+	for(size_t i = 0; i < ranges.size(); i++){
+		size_t first = ranges[i].first, last = ranges[i].second;
+
+		// Skip removed ranges that end before this range begins
+		while(j < other.ranges.size() && other.ranges[j].second <= first)
+			j++;
+
+		// Cut out each removed range that overlaps this one
+		size_t k = j;
+		while(k < other.ranges.size() && other.ranges[k].first < last){
+			if(other.ranges[k].first > first)
+				diff.push_back(range_t(first, other.ranges[k].first));
+			first = std::max(first, other.ranges[k].second);
+			if(first >= last)
+				break;
+			k++;
+		}
+
+		if(first < last)
+			diff.push_back(range_t(first, last));
+	}
+
+	ranges.swap(diff);
+}//====================================================
+
+/**
+ *  @brief Exchange the contents of this set with another set
+ *  @param other set of indices
+ */
+void ofxPlotRangeSet::swap(ofxPlotRangeSet &other){ ranges.swap(other.ranges); }
+
+//-----------------------------------------------------------------------------
+// -- Query --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the largest index in the set
+ *  @return the largest index in the set; the set must not be empty
+ */
+size_t ofxPlotRangeSet::back() const { return ranges.back().second - 1; }
+
+/**
+ *  @brief Determine whether an index is in the set
+ *  @param ix index
+ *  @return whether or not the index is in the set
+ */
+bool ofxPlotRangeSet::contains(size_t ix) const{
+	std::vector<range_t>::const_iterator it = std::upper_bound(ranges.begin(), ranges.end(), ix,
+		[](size_t val, const range_t &r){ return val < r.first; });
+
+	if(it == ranges.begin())
+		return false;
+
+	--it;
+	return ix < it->second;
+}//====================================================
+
+/**
+ *  @brief Determine whether the set is empty
+ *  @return whether or not the set contains no indices
+ */
+bool ofxPlotRangeSet::empty() const { return ranges.empty(); }
+
+/**
+ *  @brief Count the indices in the set
+ *  @return the number of indices in the set
+ */
+size_t ofxPlotRangeSet::count() const{
+	size_t n = 0;
+	for(size_t i = 0; i < ranges.size(); i++){
+		n += ranges[i].second - ranges[i].first;
+	}
+	return n;
+}//====================================================
+
+/**
+ *  @brief Retrieve the smallest index in the set
+ *  @return the smallest index in the set; the set must not be empty
+ */
+size_t ofxPlotRangeSet::front() const { return ranges.front().first; }
+
+/**
+ *  @brief Determine whether any index in a range is in the set
+ * 
+ *  @param first first index in the range
+ *  @param last one past the final index in the range
+ *  @return whether or not the set and the range have any index in common
+ */
+bool ofxPlotRangeSet::intersects(size_t first, size_t last) const{
+	if(first >= last)
+		return false;
+
+	// Locate the first range that ends after the query range begins
+	std::vector<range_t>::const_iterator it = std::upper_bound(ranges.begin(), ranges.end(), first,
+		[](size_t val, const range_t &r){ return val < r.second; });
+
+	return it != ranges.end() && it->first < last;
+}//====================================================
+
+/**
+ *  @brief Retrieve the ranges that make up the set
+ *  @return sorted, disjoint, half-open ranges
+ */
+const std::vector<ofxPlotRangeSet::range_t>& ofxPlotRangeSet::getRanges() const { return ranges; }
+
+/**
+ *  @brief Retrieve the indices that lie within a range
+ *  @details Only the ranges that overlap the query range are visited
+ * 
+ *  @param first first index in the range
+ *  @param last one past the final index in the range
+ *  @param out cleared and filled with the indices in both the set and the range
+ */
+void ofxPlotRangeSet::slice(size_t first, size_t last, ofxPlotRangeSet &out) const{
+	out.ranges.clear();
+	if(first >= last)
+		return;
+
+	std::vector<range_t>::const_iterator it = std::upper_bound(ranges.begin(), ranges.end(), first,
+		[](size_t val, const range_t &r){ return val < r.second; });
+
+	for( ; it != ranges.end() && it->first < last; ++it){
+		out.ranges.push_back(range_t(std::max(it->first, first), std::min(it->second, last)));
+	}
+}//====================================================
+
+/**
+ *  @brief Determine whether two sets contain the same indices
+ *  @param other set of indices
+ *  @return whether or not the sets are equal
+ */
+bool ofxPlotRangeSet::operator ==(const ofxPlotRangeSet &other) const { return ranges == other.ranges; }
+
+/**
+ *  @brief Determine whether two sets contain different indices
+ *  @param other set of indices
+ *  @return whether or not the sets differ
+ */
+bool ofxPlotRangeSet::operator !=(const ofxPlotRangeSet &other) const { return ranges != other.ranges; }
@@ -0,0 +1,70 @@
+/**
+ * @file ofxPlotRangeSet.hpp
+ * @brief A compact set of indices stored as sorted, disjoint ranges
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ *  @brief A set of indices stored as sorted, disjoint, half-open ranges
+ *  @details Adjacent and overlapping ranges are merged as they are added,
+ *  so the storage scales with the number of contiguous runs rather than
+ *  the number of indices. Set operations between two sets run in time
+ *  proportional to their numbers of ranges. To visit the indices, iterate
+ *  over getRanges().
+ */
+class ofxPlotRangeSet{
+public:
+	typedef std::pair<size_t, size_t> range_t;	//!< Half-open range, [first, last)
+
+	void add(size_t);
+	void add(size_t, size_t);
+	void add(const ofxPlotRangeSet&);
+	void clear();
+	void intersect(size_t, size_t);
+	void intersect(const ofxPlotRangeSet&);
+	void subtract(size_t, size_t);
+	void subtract(const ofxPlotRangeSet&);
+	void swap(ofxPlotRangeSet&);
+
+	size_t back() const;
+	bool contains(size_t) const;
+	bool empty() const;
+	size_t count() const;
+	bool intersects(size_t, size_t) const;
+	size_t front() const;
+	const std::vector<range_t>& getRanges() const;
+	void slice(size_t, size_t, ofxPlotRangeSet&) const;
+
+	bool operator ==(const ofxPlotRangeSet&) const;
+	bool operator !=(const ofxPlotRangeSet&) const;
+
+protected:
+	std::vector<range_t> ranges;	//!< Sorted, disjoint, non-adjacent ranges
+};
@@ -0,0 +1,495 @@
+/**
+ * @file ofxPlotRaster.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotRaster.hpp"
+
+#include "ofxPlotRasterFont.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define OFXPLOT_SSE2
+	#include <emmintrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a raster
+ *  @param f font to draw text with; nullptr to skip text
+ */
+ofxPlotRaster::ofxPlotRaster(std::shared_ptr<ofxPlotRasterFont> f) : font(f){}
+
+//-----------------------------------------------------------------------------
+// -- Drawing --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Allocate the image and clear it to the background color
+ *  @param area area to draw, screen coordinates; its top-left corner is
+ *  the top-left corner of the image
+ */
+void ofxPlotRaster::begin(const ofRectangle &area){
+	origin.set(area.x, area.y);
+	width = std::max(0, (int)std::ceil(area.width));
+	height = std::max(0, (int)std::ceil(area.height));
+
+	pix.allocate(width, height, OF_PIXELS_RGBA);
+	unsigned char *data = pix.getData();
+	for(size_t i = 0; i < (size_t)width*height; i++){
+		data[4*i] = background.r;
+		data[4*i + 1] = background.g;
+		data[4*i + 2] = background.b;
+		data[4*i + 3] = background.a;
+	}
+
+	mask.assign((size_t)width*height, 0);
+	maskX0 = maskY0 = 0;
+	maskX1 = maskY1 = -1;
+	rowCoverage.assign(width + 1, 0);
+}//====================================================
+
+/**
+ *  @brief Finish the drawing
+ *  @details The image is complete; retrieve it with getPixels()
+ */
+void ofxPlotRaster::end(){}
+
+/**
+ *  @brief Draw an antialiased circle outline
+ *  @see ofxPlotCanvas::drawCircle()
+ */
+void ofxPlotRaster::drawCircle(const ofVec2f &center, float radius, const ofColor &color, float w){
+	ofVec2f c = center - origin;
+	float r = 0.5f*w + 0.5f;
+	int x0 = std::max(0, (int)std::floor(c.x - radius - r)), x1 = std::min(width - 1, (int)std::ceil(c.x + radius + r));
+	int y0 = std::max(0, (int)std::floor(c.y - radius - r)), y1 = std::min(height - 1, (int)std::ceil(c.y + radius + r));
+
+	for(int py = y0; py <= y1; py++){
+		float *row = &mask[(size_t)py*width];
+		for(int px = x0; px <= x1; px++){
+			float d = std::abs(ofVec2f(px + 0.5f - c.x, py + 0.5f - c.y).length() - radius);
+			row[px] = std::max(row[px], ofClamp(r - d, 0, 1));
+		}
+	}
+	growMask(x0, y0, x1, y1);
+	flush(color);
+}//====================================================
+
+/**
+ *  @brief Draw an antialiased line segment with round caps
+ *  @see ofxPlotCanvas::drawLine()
+ */
+void ofxPlotRaster::drawLine(const ofVec2f &a, const ofVec2f &b, const ofColor &color, float w){
+	addSegment(a, b, w);
+	flush(color);
+}//====================================================
+
+/**
+ *  @brief Draw an antialiased line strip with round joins
+ *  @details The segments are merged before blending, so each pixel is
+ *  blended once even where segments overlap
+ *  @see ofxPlotCanvas::drawLineStrip()
+ */
+void ofxPlotRaster::drawLineStrip(const std::vector<ofVec3f> &pts, const ofColor &color, float w){
+	for(size_t i = 1; i < pts.size(); i++){
+		addSegment(pts[i - 1], pts[i], w);
+	}
+	flush(color);
+}//====================================================
+
+/**
+ *  @brief Draw a string with the raster's font
+ *  @details Glyphs are placed at whole pixels. Nothing is drawn without a font.
+ *  @see ofxPlotCanvas::drawText()
+ */
+void ofxPlotRaster::drawText(const std::string &str, float x, float y, const ofColor &color, bool rotated){
+	if(!hasFont() || str.empty())
+		return;
+
+	// Rotated text is laid out in a frame where screen = (v, -u); shift the
+	// frame so that the image origin maps to (0, 0) in both frames
+	float penX = rotated ? x + origin.y : x - origin.x;
+	float baseY = rotated ? y - origin.x : y - origin.y;
+
+	for(size_t i = 0; i < str.size(); i++){
+		const ofxPlotRasterFont::Glyph *g = font->getGlyph(str[i]);
+		if(!g)
+			continue;
+
+		int gx = (int)std::floor(penX + 0.5f) + g->left;
+		int gy = (int)std::floor(baseY + 0.5f) - g->top;
+		for(int v = 0; v < g->height; v++){
+			for(int u = 0; u < g->width; u++){
+				uint8_t cov = g->coverage[v*g->width + u];
+				if(cov == 0)
+					continue;
+
+				// The pixel at (u, v) in the rotated frame covers (v, -u - 1) on screen
+				int px = rotated ? gy + v : gx + u;
+				int py = rotated ? -(gx + u) - 1 : gy + v;
+				if(px < 0 || py < 0 || px >= width || py >= height)
+					continue;
+
+				float &m = mask[(size_t)py*width + px];
+				m = std::max(m, cov/255.f);
+				growMask(px, py, px, py);
+			}
+		}
+		penX += g->advance;
+	}
+	flush(color);
+}//====================================================
+
+/**
+ *  @brief Fill an antialiased circle
+ *  @see ofxPlotCanvas::fillCircle()
+ */
+void ofxPlotRaster::fillCircle(const ofVec2f &center, float radius, const ofColor &color){
+	ofVec2f c = center - origin;
+	int x0 = std::max(0, (int)std::floor(c.x - radius - 1)), x1 = std::min(width - 1, (int)std::ceil(c.x + radius + 1));
+	int y0 = std::max(0, (int)std::floor(c.y - radius - 1)), y1 = std::min(height - 1, (int)std::ceil(c.y + radius + 1));
+
+	for(int py = y0; py <= y1; py++){
+		float *row = &mask[(size_t)py*width];
+		for(int px = x0; px <= x1; px++){
+			float d = ofVec2f(px + 0.5f - c.x, py + 0.5f - c.y).length();
+			row[px] = std::max(row[px], ofClamp(radius + 0.5f - d, 0, 1));
+		}
+	}
+	growMask(x0, y0, x1, y1);
+	flush(color);
+}//====================================================
+
+/**
+ *  @brief Fill an antialiased polygon with the nonzero winding rule
+ *  @details Each pixel row is sampled at four heights; along each sample
+ *  line, the exact horizontal extent of the polygon is accumulated, so
+ *  vertical edges are exact and other edges are antialiased in both
+ *  directions. Edges are kept in an active list, so the cost grows with the
+ *  edges that cross each row rather than with all of them.
+ *  @see ofxPlotCanvas::fillPolygon()
+ */
+void ofxPlotRaster::fillPolygon(const std::vector<ofVec3f> &pts, const ofColor &color){
+	const int subRows = 4;
+	if(pts.size() < 3 || width == 0 || height == 0)
+		return;
+
+	edges.clear();
+	for(size_t i = 0; i < pts.size(); i++){
+		ofVec2f a = ofVec2f(pts[i]) - origin, b = ofVec2f(pts[(i + 1) % pts.size()]) - origin;
+		if(a.y == b.y)
+			continue;
+
+		Edge e;
+		e.dir = a.y < b.y ? 1 : -1;
+		if(e.dir < 0)
+			std::swap(a, b);
+		e.x0 = a.x; e.y0 = a.y;
+		e.x1 = b.x; e.y1 = b.y;
+		edges.push_back(e);
+	}
+	if(edges.empty())
+		return;
+
+	std::sort(edges.begin(), edges.end(), [](const Edge &l, const Edge &r){ return l.y0 < r.y0; });
+
+	float top = edges.front().y0, bottom = edges.front().y1;
+	for(size_t i = 1; i < edges.size(); i++){
+		bottom = std::max(bottom, edges[i].y1);
+	}
+
+	int y0 = std::max(0, (int)std::floor(top)), y1 = std::min(height - 1, (int)std::ceil(bottom));
+	int spanX0 = width, spanX1 = -1;
+	size_t nextEdge = 0;
+	std::vector<const Edge*> active;
+
+	for(int py = y0; py <= y1; py++){
+		int rowX0 = width, rowX1 = -1;
+		for(int sub = 0; sub < subRows; sub++){
+			float sy = py + (sub + 0.5f)/subRows;
+
+			while(nextEdge < edges.size() && edges[nextEdge].y0 <= sy){
+				active.push_back(&edges[nextEdge++]);
+			}
+			active.erase(std::remove_if(active.begin(), active.end(),
+				[sy](const Edge *e){ return e->y1 <= sy; }), active.end());
+
+			crossings.clear();
+			for(size_t i = 0; i < active.size(); i++){
+				const Edge &e = *active[i];
+				if(e.y0 > sy)
+					continue;
+				float t = (sy - e.y0)/(e.y1 - e.y0);
+				crossings.push_back(std::make_pair(e.x0 + t*(e.x1 - e.x0), e.dir));
+			}
+			std::sort(crossings.begin(), crossings.end());
+
+			// Accumulate the horizontal extent of the spans with nonzero winding
+			int winding = 0;
+			for(size_t i = 0; i + 1 < crossings.size(); i++){
+				winding += crossings[i].second;
+				if(winding == 0)
+					continue;
+
+				float xa = ofClamp(crossings[i].first, 0, width), xb = ofClamp(crossings[i + 1].first, 0, width);
+				if(xb <= xa)
+					continue;
+
+				int ia = (int)xa, ib = std::min((int)xb, width - 1);
+				const float weight = 1.f/subRows;
+				if(ia == ib){
+					rowCoverage[ia] += (xb - xa)*weight;
+				}else{
+					rowCoverage[ia] += (ia + 1 - xa)*weight;
+					for(int k = ia + 1; k < ib; k++){
+						rowCoverage[k] += weight;
+					}
+					rowCoverage[ib] += (xb - ib)*weight;
+				}
+				rowX0 = std::min(rowX0, ia);
+				rowX1 = std::max(rowX1, ib);
+			}
+		}
+
+		float *row = &mask[(size_t)py*width];
+		for(int px = rowX0; px <= rowX1; px++){
+			row[px] = std::max(row[px], std::min(rowCoverage[px], 1.f));
+			rowCoverage[px] = 0;
+		}
+		spanX0 = std::min(spanX0, rowX0);
+		spanX1 = std::max(spanX1, rowX1);
+	}
+
+	if(spanX1 >= spanX0)
+		growMask(spanX0, y0, spanX1, y1);
+	flush(color);
+}//====================================================
+
+/**
+ *  @brief Fill a rectangle, antialiasing edges that are not on pixel boundaries
+ *  @see ofxPlotCanvas::fillRect()
+ */
+void ofxPlotRaster::fillRect(const ofRectangle &r, const ofColor &color){
+	ofRectangle s = r.getStandardized();
+	std::vector<ofVec3f> pts;
+	pts.push_back(ofVec3f(s.x, s.y, 0));
+	pts.push_back(ofVec3f(s.x + s.width, s.y, 0));
+	pts.push_back(ofVec3f(s.x + s.width, s.y + s.height, 0));
+	pts.push_back(ofVec3f(s.x, s.y + s.height, 0));
+	fillPolygon(pts, color);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the image
+ *  @return the RGBA image drawn since the last begin()
+ */
+const ofPixels& ofxPlotRaster::getPixels() const { return pix; }
+
+/**
+ *  @brief Measure a string with the raster's font
+ *  @see ofxPlotCanvas::getStringBoundingBox()
+ */
+ofRectangle ofxPlotRaster::getStringBoundingBox(const std::string &str) const{
+	return hasFont() ? font->getStringBoundingBox(str, 0, 0) : ofRectangle();
+}//====================================================
+
+/**
+ *  @brief Determine whether text can be drawn
+ *  @see ofxPlotCanvas::hasFont()
+ */
+bool ofxPlotRaster::hasFont() const { return font && font->isLoaded(); }
+
+/**
+ *  @brief Set the color the image is cleared to by begin()
+ *  @param c color; transparent by default, like an exported frame buffer
+ */
+void ofxPlotRaster::setBackground(const ofColor &c){ background = c; }
+
+/**
+ *  @brief Set the font text is drawn with
+ *  @param f font; nullptr to skip text
+ */
+void ofxPlotRaster::setFont(std::shared_ptr<ofxPlotRasterFont> f){ font = f; }
+
+//-----------------------------------------------------------------------------
+// -- Rasterization --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add the coverage of a line segment with round caps to the mask
+ *  @details Only the pixels near the segment are visited: for each row, the
+ *  horizontal extent of the segment within the line's reach is computed
+ *  first
+ * 
+ *  @param a first end, screen coordinates
+ *  @param b second end, screen coordinates
+ *  @param w line width, pixels
+ */
+void ofxPlotRaster::addSegment(ofVec2f a, ofVec2f b, float w){
+	a -= origin;
+	b -= origin;
+
+	// Pixels within r of the segment are (partially) covered
+	float r = 0.5f*w + 0.5f;
+	ofVec2f d = b - a;
+	float len2 = d.squareLength();
+	float len = std::sqrt(len2);
+
+	// Vertical distance from the line's centerline that is still within r
+	float band = std::abs(d.x) > 1e-6f ? r*len/std::abs(d.x) : std::numeric_limits<float>::infinity();
+
+	int y0 = std::max(0, (int)std::floor(std::min(a.y, b.y) - r)), y1 = std::min(height - 1, (int)std::ceil(std::max(a.y, b.y) + r));
+	int spanX0 = width, spanX1 = -1;
+	for(int py = y0; py <= y1; py++){
+		float cy = py + 0.5f;
+
+		float xl = std::min(a.x, b.x), xr = std::max(a.x, b.x);
+		if(std::abs(d.y) > 1e-6f){
+			float t0 = ofClamp((cy - band - a.y)/d.y, 0, 1), t1 = ofClamp((cy + band - a.y)/d.y, 0, 1);
+			xl = std::min(a.x + t0*d.x, a.x + t1*d.x);
+			xr = std::max(a.x + t0*d.x, a.x + t1*d.x);
+		}
+
+		int x0 = std::max(0, (int)std::floor(xl - r)), x1 = std::min(width - 1, (int)std::ceil(xr + r));
+		float *row = &mask[(size_t)py*width];
+		for(int px = x0; px <= x1; px++){
+			ofVec2f p(px + 0.5f - a.x, cy - a.y);
+			float t = len2 > 0 ? ofClamp(p.dot(d)/len2, 0, 1) : 0;
+			float dist = (p - t*d).length();
+			row[px] = std::max(row[px], ofClamp(r - dist, 0, 1));
+		}
+		spanX0 = std::min(spanX0, x0);
+		spanX1 = std::max(spanX1, x1);
+	}
+
+	if(spanX1 >= spanX0)
+		growMask(spanX0, y0, spanX1, y1);
+}//====================================================
+
+/**
+ *  @brief Blend a color into a row of pixels
+ *  @details Each channel becomes dst + (src - dst)*alpha, where alpha is the
+ *  color's alpha times the pixel's coverage. With SSE2, four pixels are
+ *  blended per iteration, and groups with no coverage are skipped.
+ * 
+ *  @param dst first RGBA pixel
+ *  @param cov coverage of each pixel, 0 to 1
+ *  @param n number of pixels
+ *  @param color color to blend
+ */
+void ofxPlotRaster::blendSpan(unsigned char *dst, const float *cov, int n, const ofColor &color) const{
+	const float alpha = color.a/255.f;
+	int i = 0;
+
+#ifdef OFXPLOT_SSE2
+	const __m128 src = _mm_setr_ps(color.r, color.g, color.b, color.a);
+	const __m128 alpha4 = _mm_set1_ps(alpha);
+	const __m128i zero = _mm_setzero_si128();
+	for(; i + 4 <= n; i += 4){
+		__m128 a = _mm_mul_ps(_mm_loadu_ps(cov + i), alpha4);
+		if(_mm_movemask_ps(_mm_cmpgt_ps(a, _mm_setzero_ps())) == 0)
+			continue;
+
+		// Widen four RGBA pixels to one float vector each
+		__m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + 4*i));
+		__m128i lo = _mm_unpacklo_epi8(px, zero), hi = _mm_unpackhi_epi8(px, zero);
+		__m128 d0 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+		__m128 d1 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+		__m128 d2 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+		__m128 d3 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+
+		d0 = _mm_add_ps(d0, _mm_mul_ps(_mm_sub_ps(src, d0), _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0))));
+		d1 = _mm_add_ps(d1, _mm_mul_ps(_mm_sub_ps(src, d1), _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1))));
+		d2 = _mm_add_ps(d2, _mm_mul_ps(_mm_sub_ps(src, d2), _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2))));
+		d3 = _mm_add_ps(d3, _mm_mul_ps(_mm_sub_ps(src, d3), _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		// Round and narrow back to bytes
+		__m128i p01 = _mm_packs_epi32(_mm_cvtps_epi32(d0), _mm_cvtps_epi32(d1));
+		__m128i p23 = _mm_packs_epi32(_mm_cvtps_epi32(d2), _mm_cvtps_epi32(d3));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4*i), _mm_packus_epi16(p01, p23));
+	}
+#endif
+
+	const float rgba[4] = {(float)color.r, (float)color.g, (float)color.b, (float)color.a};
+	for(; i < n; i++){
+		float a = cov[i]*alpha;
+		if(a <= 0)
+			continue;
+
+		unsigned char *p = dst + 4*i;
+		for(int c = 0; c < 4; c++){
+			p[c] = (unsigned char)(p[c] + (rgba[c] - p[c])*a + 0.5f);
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Blend the shape in the mask into the image and clear the mask
+ *  @param color color of the shape
+ */
+void ofxPlotRaster::flush(const ofColor &color){
+	if(maskX1 < maskX0 || maskY1 < maskY0)
+		return;
+
+	unsigned char *data = pix.getData();
+	int n = maskX1 - maskX0 + 1;
+	for(int py = maskY0; py <= maskY1; py++){
+		float *row = &mask[(size_t)py*width + maskX0];
+		blendSpan(data + 4*((size_t)py*width + maskX0), row, n, color);
+		std::fill(row, row + n, 0.f);
+	}
+
+	maskX0 = maskY0 = 0;
+	maskX1 = maskY1 = -1;
+}//====================================================
+
+/**
+ *  @brief Extend the area of the mask in use
+ * 
+ *  @param x0 left pixel
+ *  @param y0 top pixel
+ *  @param x1 right pixel
+ *  @param y1 bottom pixel
+ */
+void ofxPlotRaster::growMask(int x0, int y0, int x1, int y1){
+	if(maskX1 < maskX0 || maskY1 < maskY0){
+		maskX0 = x0; maskY0 = y0;
+		maskX1 = x1; maskY1 = y1;
+	}else{
+		maskX0 = std::min(maskX0, x0); maskY0 = std::min(maskY0, y0);
+		maskX1 = std::max(maskX1, x1); maskY1 = std::max(maskY1, y1);
+	}
+}//====================================================
@@ -0,0 +1,111 @@
+/**
+ * @file ofxPlotRaster.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofxPlotCanvas.hpp"
+
+#include "ofMain.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations
+class ofxPlotRasterFont;
+
+/**
+ *  @brief Canvas that rasterizes into an in-memory RGBA image on the CPU
+ *  @details No window or OpenGL context is needed, and each raster holds
+ *  all of its own state, so many plots can be rendered concurrently, one
+ *  raster per thread (see ofxPlot::drawTo()).
+ * 
+ *  Every shape is first rasterized into a per-pixel coverage mask, with
+ *  analytic antialiasing for lines and circles and four subsamples per row
+ *  for polygons; the mask is then blended into the image in one pass, four
+ *  pixels at a time with SSE2 where available. Because a whole shape is
+ *  blended at once, overlapping segments of a translucent line strip do
+ *  not darken their joints. Blending matches OpenGL's
+ *  GL_SRC_ALPHA/GL_ONE_MINUS_SRC_ALPHA on every channel, as set by
+ *  ofEnableAlphaBlending().
+ * 
+ *  Text is drawn with an ofxPlotRasterFont; without one, text is skipped.
+ *  Compared with the OpenGL path, line joins are round rather than mitered,
+ *  glyph positions are snapped to whole pixels, and kerning is not applied,
+ *  so images should be compared with a small per-pixel tolerance.
+ */
+class ofxPlotRaster : public ofxPlotCanvas{
+public:
+	ofxPlotRaster(std::shared_ptr<ofxPlotRasterFont> = nullptr);
+
+	void begin(const ofRectangle&);
+	void end();
+
+	void drawCircle(const ofVec2f&, float, const ofColor&, float);
+	void drawLine(const ofVec2f&, const ofVec2f&, const ofColor&, float);
+	void drawLineStrip(const std::vector<ofVec3f>&, const ofColor&, float);
+	void drawText(const std::string&, float, float, const ofColor&, bool);
+	void fillCircle(const ofVec2f&, float, const ofColor&);
+	void fillPolygon(const std::vector<ofVec3f>&, const ofColor&);
+	void fillRect(const ofRectangle&, const ofColor&);
+
+	const ofPixels& getPixels() const;
+	ofRectangle getStringBoundingBox(const std::string&) const;
+	bool hasFont() const;
+
+	void setBackground(const ofColor&);
+	void setFont(std::shared_ptr<ofxPlotRasterFont>);
+
+protected:
+	/**
+	 *  @brief A polygon edge, in image coordinates, directed downward
+	 */
+	struct Edge{
+		float x0, y0;		//!< Upper end
+		float x1, y1;		//!< Lower end
+		int dir;			//!< Winding direction: +1 if the polygon runs downward along the edge, -1 if upward
+	};
+
+	ofPixels pix;								//!< The image
+	int width = 0, height = 0;					//!< Image size, pixels
+	ofVec2f origin;								//!< Screen location of the top-left corner of the image
+	ofColor background = ofColor(0, 0, 0, 0);	//!< Color the image is cleared to by begin()
+	std::shared_ptr<ofxPlotRasterFont> font;	//!< Font text is drawn with; may be nullptr
+
+	std::vector<float> mask;					//!< Coverage of the current shape, 0 to 1, one per pixel
+	int maskX0 = 0, maskY0 = 0;					//!< Top-left pixel of the area of the mask in use
+	int maskX1 = -1, maskY1 = -1;				//!< Bottom-right pixel of the area of the mask in use
+
+	std::vector<Edge> edges;					//!< Scratch storage for polygon edges
+	std::vector<float> rowCoverage;				//!< Scratch storage for the coverage of a polygon row
+	std::vector<std::pair<float, int> > crossings;	//!< Scratch storage for the edge crossings of a polygon subrow
+
+	void addSegment(ofVec2f, ofVec2f, float);
+	void blendSpan(unsigned char*, const float*, int, const ofColor&) const;
+	void flush(const ofColor&);
+	void growMask(int, int, int, int);
+};
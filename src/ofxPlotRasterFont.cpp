@@ -0,0 +1,194 @@
+/**
+ * @file ofxPlotRasterFont.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotRasterFont.hpp"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve a font shared by the whole application
+ *  @details Each face and size is loaded the first time it is requested
+ *  while nothing holds it; later requests, from any thread, return the same
+ *  font.
+ * 
+ *  @param path font file, relative to the data directory
+ *  @param size font size, points
+ *  @return the font, or nullptr if it could not be loaded
+ */
+std::shared_ptr<ofxPlotRasterFont> ofxPlotRasterFont::getShared(const std::string &path, int size){
+	static std::mutex mtx;
+	static std::map<std::pair<std::string, int>, std::weak_ptr<ofxPlotRasterFont> > fonts;
+
+	std::lock_guard<std::mutex> lock(mtx);
+	std::weak_ptr<ofxPlotRasterFont> &entry = fonts[std::make_pair(path, size)];
+	std::shared_ptr<ofxPlotRasterFont> f = entry.lock();
+	if(f)
+		return f;
+
+	f = std::make_shared<ofxPlotRasterFont>();
+	if(!f->load(path, size)){
+		fonts.erase(std::make_pair(path, size));
+		return nullptr;
+	}
+
+	entry = f;
+	return f;
+}//====================================================
+
+/**
+ *  @brief Render the glyphs of a font file
+ *  @details Do not call this while other threads are using the font
+ * 
+ *  @param path font file, relative to the data directory
+ *  @param s font size, points
+ *  @return whether or not the font was loaded
+ */
+bool ofxPlotRasterFont::load(const std::string &path, int s){
+	glyphs.clear();
+	size = 0;
+
+	FT_Library lib;
+	if(FT_Init_FreeType(&lib) != 0){
+		ofLogWarning("ofxPlotRasterFont") << "load: could not initialize FreeType";
+		return false;
+	}
+
+	FT_Face face;
+	if(FT_New_Face(lib, ofToDataPath(path, true).c_str(), 0, &face) != 0){
+		ofLogWarning("ofxPlotRasterFont") << "load: could not load " << path;
+		FT_Done_FreeType(lib);
+		return false;
+	}
+
+	FT_Set_Char_Size(face, s << 6, s << 6, dpi, dpi);
+	lineHeight = face->size->metrics.height/64.f;
+
+	glyphs.resize(lastChar - firstChar + 1);
+	for(int c = firstChar; c <= lastChar; c++){
+		if(FT_Load_Char(face, c, FT_LOAD_RENDER) != 0)
+			continue;
+
+		const FT_GlyphSlot slot = face->glyph;
+		Glyph &g = glyphs[c - firstChar];
+		g.width = slot->bitmap.width;
+		g.height = slot->bitmap.rows;
+		g.left = slot->bitmap_left;
+		g.top = slot->bitmap_top;
+		g.advance = slot->advance.x/64.f;
+		g.coverage.resize(g.width*g.height);
+		for(int y = 0; y < g.height; y++){
+			const unsigned char *row = slot->bitmap.buffer + y*slot->bitmap.pitch;
+			std::copy(row, row + g.width, g.coverage.begin() + y*g.width);
+		}
+	}
+
+	FT_Done_Face(face);
+	FT_Done_FreeType(lib);
+
+	size = s;
+	return true;
+}//====================================================
+
+/**
+ *  @brief Retrieve the glyph of a character
+ *  @param c character
+ *  @return pointer to the glyph, or nullptr if the character is not rendered
+ */
+const ofxPlotRasterFont::Glyph* ofxPlotRasterFont::getGlyph(char c) const{
+	int ix = (unsigned char)c - firstChar;
+	return ix >= 0 && ix < (int)glyphs.size() ? &glyphs[ix] : nullptr;
+}//====================================================
+
+/**
+ *  @brief Retrieve the distance between baselines
+ *  @return the line height, pixels
+ */
+float ofxPlotRasterFont::getLineHeight() const { return lineHeight; }
+
+/**
+ *  @brief Retrieve the bytes held by the glyph masks
+ *  @return the number of bytes
+ */
+size_t ofxPlotRasterFont::getMemoryUsage() const{
+	size_t bytes = glyphs.capacity()*sizeof(Glyph);
+	for(size_t i = 0; i < glyphs.size(); i++){
+		bytes += glyphs[i].coverage.capacity();
+	}
+	return bytes;
+}//====================================================
+
+/**
+ *  @brief Retrieve the font size
+ *  @return the size, points; zero if no font is loaded
+ */
+int ofxPlotRasterFont::getSize() const { return size; }
+
+/**
+ *  @brief Measure a single line of text
+ * 
+ *  @param str text
+ *  @param x horizontal location of the baseline start
+ *  @param y vertical location of the baseline
+ *  @return the smallest rectangle that holds every glyph mask
+ */
+ofRectangle ofxPlotRasterFont::getStringBoundingBox(const std::string &str, float x, float y) const{
+	float minX = 0, maxX = 0, minY = 0, maxY = 0;
+	bool bEmpty = true;
+	float pen = x;
+	for(size_t i = 0; i < str.size(); i++){
+		const Glyph *g = getGlyph(str[i]);
+		if(!g)
+			continue;
+
+		if(g->width > 0 && g->height > 0){
+			float x0 = pen + g->left, y0 = y - g->top;
+			minX = bEmpty ? x0 : std::min(minX, x0);
+			minY = bEmpty ? y0 : std::min(minY, y0);
+			maxX = bEmpty ? x0 + g->width : std::max(maxX, x0 + g->width);
+			maxY = bEmpty ? y0 + g->height : std::max(maxY, y0 + g->height);
+			bEmpty = false;
+		}
+		pen += g->advance;
+	}
+
+	return bEmpty ? ofRectangle(x, y, 0, 0) : ofRectangle(minX, minY, maxX - minX, maxY - minY);
+}//====================================================
+
+/**
+ *  @brief Determine whether a font is loaded
+ *  @return whether or not the glyphs have been rendered
+ */
+bool ofxPlotRasterFont::isLoaded() const { return size > 0; }
@@ -0,0 +1,80 @@
+/**
+ * @file ofxPlotRasterFont.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ *  @brief Antialiased glyph coverage masks for drawing text without OpenGL
+ *  @details The printable ASCII characters are rendered with FreeType when
+ *  the font is loaded, at the same resolution ofTrueTypeFont uses, so a
+ *  face and size match the on-screen text. After loading, the font is never
+ *  modified, so one font may be used by any number of threads at once.
+ *  Characters outside the printable ASCII range are skipped. Kerning is
+ *  not applied.
+ *  @see ofxPlotRaster
+ */
+class ofxPlotRasterFont{
+public:
+	/**
+	 *  @brief Coverage mask and metrics of a single character
+	 */
+	struct Glyph{
+		int width = 0;					//!< Mask width, pixels
+		int height = 0;					//!< Mask height, pixels
+		int left = 0;					//!< Offset from the pen position to the left edge of the mask, pixels
+		int top = 0;					//!< Offset from the baseline up to the top edge of the mask, pixels
+		float advance = 0;				//!< Distance the pen moves after the character, pixels
+		std::vector<uint8_t> coverage;	//!< Row-major coverage, 0 to 255
+	};
+
+	static std::shared_ptr<ofxPlotRasterFont> getShared(const std::string&, int);
+
+	bool load(const std::string&, int);
+
+	const Glyph* getGlyph(char) const;
+	float getLineHeight() const;
+	size_t getMemoryUsage() const;
+	int getSize() const;
+	ofRectangle getStringBoundingBox(const std::string&, float, float) const;
+	bool isLoaded() const;
+
+protected:
+	static const int firstChar = 32;	//!< First character that is rendered (space)
+	static const int lastChar = 126;	//!< Last character that is rendered (tilde)
+	static const int dpi = 96;			//!< Resolution the font is rendered at; ofTrueTypeFont's default
+
+	std::vector<Glyph> glyphs;			//!< Glyphs of firstChar through lastChar
+	float lineHeight = 0;				//!< Distance between baselines, pixels
+	int size = 0;						//!< Font size, points
+};
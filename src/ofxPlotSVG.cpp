@@ -0,0 +1,205 @@
+/**
+ * @file ofxPlotSVG.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotSVG.hpp"
+
+#include "ofxPlotFont.hpp"
+
+#include <sstream>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a canvas that writes to a stream
+ * 
+ *  @param o stream to write the document to; must outlive the canvas
+ *  @param f font the text is laid out with, or nullptr for the bitmap font
+ */
+ofxPlotSVG::ofxPlotSVG(std::ostream &o, std::shared_ptr<ofxPlotFont> f) : out(o), font(f){
+	if(hasFont())
+		fontAttr = " font-family=\"sans-serif\" font-size=\"" + ofToString(font->getFont().getSize()) + "\"";
+	else
+		fontAttr = " font-family=\"monospace\" font-size=\"11\"";
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Drawing --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Write the document header
+ *  @param area area to draw, screen coordinates; becomes the view box
+ */
+void ofxPlotSVG::begin(const ofRectangle &area){
+	out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+	out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << area.width << "\" height=\"" << area.height
+		<< "\" viewBox=\"" << area.x << " " << area.y << " " << area.width << " " << area.height << "\">\n";
+}//====================================================
+
+/**
+ *  @brief Close the document
+ */
+void ofxPlotSVG::end(){ out << "</svg>\n"; }
+
+/**
+ *  @brief Write a circle outline
+ *  @see ofxPlotCanvas::drawCircle()
+ */
+void ofxPlotSVG::drawCircle(const ofVec2f &center, float radius, const ofColor &color, float width){
+	out << "<circle cx=\"" << center.x << "\" cy=\"" << center.y << "\" r=\"" << radius << "\" fill=\"none\" stroke-width=\""
+		<< width << "\"" << getPaint("stroke", color) << "/>\n";
+}//====================================================
+
+/**
+ *  @brief Write a line segment
+ *  @see ofxPlotCanvas::drawLine()
+ */
+void ofxPlotSVG::drawLine(const ofVec2f &a, const ofVec2f &b, const ofColor &color, float width){
+	out << "<line x1=\"" << a.x << "\" y1=\"" << a.y << "\" x2=\"" << b.x << "\" y2=\"" << b.y
+		<< "\" stroke-width=\"" << width << "\"" << getPaint("stroke", color) << "/>\n";
+}//====================================================
+
+/**
+ *  @brief Write a polyline
+ *  @see ofxPlotCanvas::drawLineStrip()
+ */
+void ofxPlotSVG::drawLineStrip(const std::vector<ofVec3f> &pts, const ofColor &color, float width){
+	if(pts.empty())
+		return;
+
+	out << "<polyline points=\"";
+	for(size_t i = 0; i < pts.size(); i++){
+		out << (i > 0 ? " " : "") << pts[i].x << "," << pts[i].y;
+	}
+	out << "\" fill=\"none\" stroke-width=\"" << width << "\" stroke-linejoin=\"round\"" << getPaint("stroke", color) << "/>\n";
+}//====================================================
+
+/**
+ *  @brief Write a text element
+ *  @see ofxPlotCanvas::drawText()
+ */
+void ofxPlotSVG::drawText(const std::string &str, float x, float y, const ofColor &color, bool rotated){
+	if(str.empty())
+		return;
+
+	out << "<text" << (rotated ? " transform=\"rotate(-90)\"" : "") << " x=\"" << x << "\" y=\"" << y << "\""
+		<< fontAttr << getPaint("fill", color) << ">" << escapeXML(str) << "</text>\n";
+}//====================================================
+
+/**
+ *  @brief Write a filled circle
+ *  @see ofxPlotCanvas::fillCircle()
+ */
+void ofxPlotSVG::fillCircle(const ofVec2f &center, float radius, const ofColor &color){
+	out << "<circle cx=\"" << center.x << "\" cy=\"" << center.y << "\" r=\"" << radius << "\"" << getPaint("fill", color) << "/>\n";
+}//====================================================
+
+/**
+ *  @brief Write a filled polygon
+ *  @see ofxPlotCanvas::fillPolygon()
+ */
+void ofxPlotSVG::fillPolygon(const std::vector<ofVec3f> &pts, const ofColor &color){
+	if(pts.size() < 3)
+		return;
+
+	out << "<polygon points=\"";
+	for(size_t i = 0; i < pts.size(); i++){
+		out << (i > 0 ? " " : "") << pts[i].x << "," << pts[i].y;
+	}
+	out << "\"" << getPaint("fill", color) << "/>\n";
+}//====================================================
+
+/**
+ *  @brief Write a filled rectangle
+ *  @see ofxPlotCanvas::fillRect()
+ */
+void ofxPlotSVG::fillRect(const ofRectangle &r, const ofColor &color){
+	ofRectangle s = r.getStandardized();
+	out << "<rect x=\"" << s.x << "\" y=\"" << s.y << "\" width=\"" << s.width << "\" height=\"" << s.height
+		<< "\"" << getPaint("fill", color) << "/>\n";
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Measure a string with the font's metrics
+ *  @see ofxPlotCanvas::getStringBoundingBox()
+ */
+ofRectangle ofxPlotSVG::getStringBoundingBox(const std::string &str) const{
+	return hasFont() ? font->getStringBoundingBox(str, 0, 0) : ofRectangle();
+}//====================================================
+
+/**
+ *  @brief Determine whether the text is laid out with a loaded font
+ *  @see ofxPlotCanvas::hasFont()
+ */
+bool ofxPlotSVG::hasFont() const { return font && font->isLoaded(); }
+
+//-----------------------------------------------------------------------------
+// -- Utilities --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Escape the characters that cannot appear in XML text
+ *  @param str text to escape
+ *  @return the escaped text
+ */
+std::string ofxPlotSVG::escapeXML(const std::string &str){
+	std::string esc;
+	esc.reserve(str.size());
+	for(size_t i = 0; i < str.size(); i++){
+		switch(str[i]){
+			case '&': esc += "&amp;"; break;
+			case '<': esc += "&lt;"; break;
+			case '>': esc += "&gt;"; break;
+			case '"': esc += "&quot;"; break;
+			default: esc += str[i];
+		}
+	}
+	return esc;
+}//====================================================
+
+/**
+ *  @brief Format a color as SVG paint attributes
+ *  @details For example, getPaint("fill", ofColor(255, 0, 0, 128)) returns
+ *  ` fill="rgb(255,0,0)" fill-opacity="0.502"`
+ * 
+ *  @param attr paint attribute, i.e., "fill" or "stroke"
+ *  @param c color
+ *  @return the attributes, with a leading space
+ */
+std::string ofxPlotSVG::getPaint(const std::string &attr, const ofColor &c){
+	std::ostringstream paint;
+	paint << " " << attr << "=\"rgb(" << (int)c.r << "," << (int)c.g << "," << (int)c.b << ")\"";
+	if(c.a < 255)
+		paint << " " << attr << "-opacity=\"" << ofToString(c.a/255.f, 3) << "\"";
+	return paint.str();
+}//====================================================
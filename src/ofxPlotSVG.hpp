@@ -0,0 +1,73 @@
+/**
+ * @file ofxPlotSVG.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofxPlotCanvas.hpp"
+
+#include "ofMain.h"
+
+#include <memory>
+#include <ostream>
+#include <string>
+
+// Forward declarations
+class ofxPlotFont;
+
+/**
+ *  @brief Canvas that writes a standalone SVG document
+ *  @details Text is written as text elements and sized to match the font
+ *  used on screen, if any, so that the plot lays out its labels the same
+ *  way; the viewer substitutes a sans-serif face. Without a font, text is
+ *  laid out for the bitmap font and written in a monospace face.
+ */
+class ofxPlotSVG : public ofxPlotCanvas{
+public:
+	ofxPlotSVG(std::ostream&, std::shared_ptr<ofxPlotFont> = nullptr);
+
+	void begin(const ofRectangle&);
+	void end();
+
+	void drawCircle(const ofVec2f&, float, const ofColor&, float);
+	void drawLine(const ofVec2f&, const ofVec2f&, const ofColor&, float);
+	void drawLineStrip(const std::vector<ofVec3f>&, const ofColor&, float);
+	void drawText(const std::string&, float, float, const ofColor&, bool);
+	void fillCircle(const ofVec2f&, float, const ofColor&);
+	void fillPolygon(const std::vector<ofVec3f>&, const ofColor&);
+	void fillRect(const ofRectangle&, const ofColor&);
+
+	ofRectangle getStringBoundingBox(const std::string&) const;
+	bool hasFont() const;
+
+	static std::string escapeXML(const std::string&);
+	static std::string getPaint(const std::string&, const ofColor&);
+
+protected:
+	std::ostream &out;					//!< Stream the document is written to
+	std::shared_ptr<ofxPlotFont> font;	//!< Font whose metrics lay out the text; may be nullptr
+	std::string fontAttr = "";			//!< Font attributes shared by all text elements
+};
@@ -0,0 +1,131 @@
+/**
+ * @file ofxPlotScheduler.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotScheduler.hpp"
+
+#include "ofMain.h"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a scheduler
+ *  @param us time available each frame, microseconds
+ */
+ofxPlotScheduler::ofxPlotScheduler(uint64_t us) : budget(us), remaining(us), frame(ofGetFrameNum()){}
+
+//-----------------------------------------------------------------------------
+// -- Budget --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Restore the full budget for a new frame
+ *  @details This is only required when frames are not counted by
+ *  openFrameworks, e.g., in a headless loop
+ */
+void ofxPlotScheduler::beginFrame(){
+	frame = ofGetFrameNum();
+	remaining = budget.load();
+}//====================================================
+
+/**
+ *  @brief Take time from the current frame's budget
+ *  @details Callers must stop working once the granted time has elapsed and
+ *  release() any time they did not use
+ * 
+ *  @param us time requested, microseconds
+ *  @return the time granted, microseconds; at most the time requested, and
+ *  zero once the budget is exhausted
+ */
+uint64_t ofxPlotScheduler::acquire(uint64_t us){
+	checkFrame();
+
+	int64_t avail = remaining.load();
+	int64_t grant = 0;
+	do{
+		grant = std::min<int64_t>(std::max<int64_t>(avail, 0), us);
+	}while(grant > 0 && !remaining.compare_exchange_weak(avail, avail - grant));
+
+	return grant;
+}//====================================================
+
+/**
+ *  @brief Return unused time to the current frame's budget
+ *  @param us unused time, microseconds
+ */
+void ofxPlotScheduler::release(uint64_t us){
+	remaining += us;
+}//====================================================
+
+/**
+ *  @brief Restore the budget if a new frame has begun since it was last used
+ */
+void ofxPlotScheduler::checkFrame(){
+	uint64_t now = ofGetFrameNum();
+	uint64_t prev = frame.load();
+	if(prev != now && frame.compare_exchange_strong(prev, now))
+		remaining = budget.load();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve a scheduler shared by the whole application
+ *  @details The scheduler is created on first use with the default budget
+ *  @return the shared scheduler
+ */
+std::shared_ptr<ofxPlotScheduler> ofxPlotScheduler::getShared(){
+	static std::shared_ptr<ofxPlotScheduler> shared = std::make_shared<ofxPlotScheduler>();
+	return shared;
+}//====================================================
+
+/**
+ *  @brief Retrieve the time available each frame
+ *  @return the budget, microseconds
+ */
+uint64_t ofxPlotScheduler::getBudget() const { return budget; }
+
+/**
+ *  @brief Retrieve the time left in the current frame
+ *  @return the remaining time, microseconds
+ */
+uint64_t ofxPlotScheduler::getRemaining(){
+	checkFrame();
+	return std::max<int64_t>(remaining.load(), 0);
+}//====================================================
+
+/**
+ *  @brief Set the time available each frame
+ *  @details The new budget takes effect on the next frame
+ *  @param us budget, microseconds
+ */
+void ofxPlotScheduler::setBudget(uint64_t us){ budget = us; }
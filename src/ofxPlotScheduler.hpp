@@ -0,0 +1,68 @@
+/**
+ * @file ofxPlotScheduler.hpp
+ * @brief Shares a per-frame time budget for incremental work across widgets
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ *  @brief Shares a per-frame time budget among widgets that can spread their
+ *  work across frames
+ *  @details Each frame, widgets acquire time from the budget before doing
+ *  incremental work (e.g., progressive refinement), stop when their grant is
+ *  spent, and release whatever they did not use. Once the budget is exhausted,
+ *  widgets draw what they have and continue on a later frame, so the total time
+ *  spent on deferrable work per frame stays bounded no matter how much data is
+ *  plotted. The budget is restored at the start of each frame; this happens
+ *  automatically when the frame number changes, or explicitly with
+ *  beginFrame(). All functions are thread safe, so widgets may acquire time
+ *  while they are prepared in parallel.
+ */
+class ofxPlotScheduler{
+public:
+	ofxPlotScheduler(uint64_t = 4000);
+
+	static std::shared_ptr<ofxPlotScheduler> getShared();
+
+	void beginFrame();
+	uint64_t acquire(uint64_t);
+	void release(uint64_t);
+
+	uint64_t getBudget() const;
+	uint64_t getRemaining();
+	void setBudget(uint64_t);
+
+protected:
+	std::atomic<uint64_t> budget;		//!< Time available each frame, microseconds
+	std::atomic<int64_t> remaining;		//!< Time left in the current frame, microseconds
+	std::atomic<uint64_t> frame;		//!< Frame number the remaining time belongs to
+
+	void checkFrame();
+};
@@ -0,0 +1,173 @@
+/**
+ * @file ofxPlotSelectionGroup.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotSelectionGroup.hpp"
+
+#include "dataSelectedEvent.hpp"
+
+std::map<std::string, std::weak_ptr<ofxPlotSelectionGroup> > ofxPlotSelectionGroup::namedGroups;
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an independent selection group
+ *  @details To share a named group between objects, use get() instead
+ *  @param n name of the group, for reference only
+ */
+ofxPlotSelectionGroup::ofxPlotSelectionGroup(std::string n) : name(n){
+	model = std::make_shared<ofxPlotSelectionModel>();
+	selected = &ownSelected;
+	deselected = &ownDeselected;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve a named group, creating it if it does not exist
+ *  @param n name of the group; an empty name refers to the default group
+ *  @return pointer to the group
+ */
+std::shared_ptr<ofxPlotSelectionGroup> ofxPlotSelectionGroup::get(std::string n){
+	if(n.empty())
+		return getDefault();
+
+	std::shared_ptr<ofxPlotSelectionGroup> group = namedGroups[n].lock();
+	if(!group){
+		group = std::make_shared<ofxPlotSelectionGroup>(n);
+		namedGroups[n] = group;
+	}
+	return group;
+}//====================================================
+
+/**
+ *  @brief Retrieve the default group
+ *  @details The default group sends its events through the global
+ *  DataSelectedEvent events
+ *  @return pointer to the default group
+ */
+std::shared_ptr<ofxPlotSelectionGroup> ofxPlotSelectionGroup::getDefault(){
+	static std::shared_ptr<ofxPlotSelectionGroup> group;
+	if(!group){
+		group = std::make_shared<ofxPlotSelectionGroup>();
+		group->selected = &DataSelectedEvent::selected;
+		group->deselected = &DataSelectedEvent::deselected;
+	}
+	return group;
+}//====================================================
+
+/**
+ *  @brief Retrieve the event that carries selections within this group
+ *  @return the selection event
+ */
+ofEvent<DataSelectedEventArgs>& ofxPlotSelectionGroup::getSelectedEvent(){ return *selected; }
+
+/**
+ *  @brief Retrieve the event that carries deselections within this group
+ *  @return the deselection event
+ */
+ofEvent<DataSelectedEventArgs>& ofxPlotSelectionGroup::getDeselectedEvent(){ return *deselected; }
+
+/**
+ *  @brief Retrieve the name of the group
+ *  @return the name of the group
+ */
+std::string ofxPlotSelectionGroup::getName() const { return name; }
+
+/**
+ *  @brief Retrieve the selection model shared by the members of this group
+ *  @details Use the model to check the selection version and to query the
+ *  selected indices within a range; modify the selection with select() and
+ *  deselect() so that the members are notified
+ *  @return pointer to the selection model
+ */
+std::shared_ptr<const ofxPlotSelectionModel> ofxPlotSelectionGroup::getModel() const { return model; }
+
+//-----------------------------------------------------------------------------
+// -- Notify --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Clear the selection and notify the members of this group
+ *  @details No event is sent if nothing is selected
+ */
+void ofxPlotSelectionGroup::deselect(){
+	std::shared_ptr<ofxPlotRangeSet> removed = std::make_shared<ofxPlotRangeSet>();
+	if(!model->set(ofxPlotRangeSet(), nullptr, removed.get()))
+		return;
+
+	DataSelectedEventArgs args;
+	args.indices = model->getSelection();
+	args.added = std::make_shared<ofxPlotRangeSet>();
+	args.removed = removed;
+	args.version = model->getVersion();
+
+	notifyDeselected(args);
+}//====================================================
+
+/**
+ *  @brief Replace the selection and notify the members of this group
+ *  @details The event carries the full selection along with the indices
+ *  that were added and removed since the previous version. No event is sent
+ *  if the selection is unchanged.
+ * 
+ *  @param ixs selected indices
+ */
+void ofxPlotSelectionGroup::select(const ofxPlotRangeSet &ixs){
+	std::shared_ptr<ofxPlotRangeSet> added = std::make_shared<ofxPlotRangeSet>();
+	std::shared_ptr<ofxPlotRangeSet> removed = std::make_shared<ofxPlotRangeSet>();
+	if(!model->set(ixs, added.get(), removed.get()))
+		return;
+
+	DataSelectedEventArgs args;
+	args.indices = model->getSelection();
+	args.added = added;
+	args.removed = removed;
+	args.version = model->getVersion();
+
+	notifySelected(args);
+}//====================================================
+
+/**
+ *  @brief Send a deselection to the members of this group
+ *  @param args event arguments; delivered by reference to every listener
+ */
+void ofxPlotSelectionGroup::notifyDeselected(DataSelectedEventArgs &args){
+	args.group = this;
+	ofNotifyEvent(*deselected, args);
+}//====================================================
+
+/**
+ *  @brief Send a selection to the members of this group
+ *  @param args event arguments; delivered by reference to every listener
+ */
+void ofxPlotSelectionGroup::notifySelected(DataSelectedEventArgs &args){
+	args.group = this;
+	ofNotifyEvent(*selected, args);
+}//====================================================
@@ -0,0 +1,88 @@
+/**
+ * @file ofxPlotSelectionGroup.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "ofMain.h"
+#include "ofxPlotRangeSet.hpp"
+#include "ofxPlotSelectionModel.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+
+// Forward declarations
+class DataSelectedEventArgs;
+
+/**
+ *  @brief A channel that carries data selection events between objects
+ *  @details Selection events are only delivered to the objects in the group
+ *  they are sent to, so independent sets of linked plots do not pay for each
+ *  other's interactions. Objects join the default group when they are
+ *  constructed; the default group sends its events through the global
+ *  DataSelectedEvent::selected and DataSelectedEvent::deselected events so
+ *  that existing listeners continue to work.
+ * 
+ *  Groups are shared by pointer. Named groups are created on first use and
+ *  persist while any object holds them; pass the same name to link objects
+ *  without passing a pointer around.
+ * 
+ *  The group owns the selection model that its members share. Each change
+ *  made through select() or deselect() increments the model's version and is
+ *  sent with the indices that were added and removed, so listeners can apply
+ *  the change incrementally and ignore versions they have already seen.
+ */
+class ofxPlotSelectionGroup{
+public:
+	ofxPlotSelectionGroup(std::string = "");
+
+	static std::shared_ptr<ofxPlotSelectionGroup> get(std::string);
+	static std::shared_ptr<ofxPlotSelectionGroup> getDefault();
+
+	ofEvent<DataSelectedEventArgs>& getSelectedEvent();
+	ofEvent<DataSelectedEventArgs>& getDeselectedEvent();
+	std::string getName() const;
+	std::shared_ptr<const ofxPlotSelectionModel> getModel() const;
+
+	void deselect();
+	void select(const ofxPlotRangeSet&);
+
+	void notifyDeselected(DataSelectedEventArgs&);
+	void notifySelected(DataSelectedEventArgs&);
+
+protected:
+	std::string name = "";		//!< Name of the group; empty for the default and unnamed groups
+
+	std::shared_ptr<ofxPlotSelectionModel> model;	//!< Current selection, shared by the members of the group
+
+	ofEvent<DataSelectedEventArgs> ownSelected;		//!< Selection event, unless the group uses the global event
+	ofEvent<DataSelectedEventArgs> ownDeselected;	//!< Deselection event, unless the group uses the global event
+
+	ofEvent<DataSelectedEventArgs> *selected;		//!< Event that selections are sent through
+	ofEvent<DataSelectedEventArgs> *deselected;		//!< Event that deselections are sent through
+
+	static std::map<std::string, std::weak_ptr<ofxPlotSelectionGroup> > namedGroups;	//!< Registry of named groups
+};
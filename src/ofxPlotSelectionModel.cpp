@@ -0,0 +1,112 @@
+/**
+ * @file ofxPlotSelectionModel.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotSelectionModel.hpp"
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a model with an empty selection at version 0
+ */
+ofxPlotSelectionModel::ofxPlotSelectionModel(){
+	selection = std::make_shared<ofxPlotRangeSet>();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Query --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the current selection
+ *  @return pointer to the selected indices; the set is never modified, so
+ *  the pointer may be held indefinitely
+ */
+std::shared_ptr<const ofxPlotRangeSet> ofxPlotSelectionModel::getSelection() const { return selection; }
+
+/**
+ *  @brief Retrieve the selected indices that lie within a range
+ *  @details The cost is proportional to the number of selected ranges
+ *  within the query range, not to the size of the whole selection
+ * 
+ *  @param first first index in the range
+ *  @param last one past the final index in the range
+ *  @param out cleared and filled with the selected indices in the range
+ */
+void ofxPlotSelectionModel::getSelectionInRange(size_t first, size_t last, ofxPlotRangeSet &out) const{
+	selection->slice(first, last, out);
+}//====================================================
+
+/**
+ *  @brief Retrieve the selection version
+ *  @return the number of times the selection has changed
+ */
+uint64_t ofxPlotSelectionModel::getVersion() const { return version; }
+
+/**
+ *  @brief Determine whether any selected index lies within a range
+ * 
+ *  @param first first index in the range
+ *  @param last one past the final index in the range
+ *  @return whether or not any index in the range is selected
+ */
+bool ofxPlotSelectionModel::hasSelectionInRange(size_t first, size_t last) const{
+	return selection->intersects(first, last);
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Modify --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Replace the selection
+ *  @details If the selection changes, a new snapshot is created and the
+ *  version is incremented
+ * 
+ *  @param ixs selected indices
+ *  @param added if not nullptr, receives the indices that were added
+ *  @param removed if not nullptr, receives the indices that were removed
+ *  @return whether or not the selection changed
+ */
+bool ofxPlotSelectionModel::set(const ofxPlotRangeSet &ixs, ofxPlotRangeSet *added, ofxPlotRangeSet *removed){
+	if(ixs == *selection)
+		return false;
+
+	if(added){
+		*added = ixs;
+		added->subtract(*selection);
+	}
+
+	if(removed){
+		*removed = *selection;
+		removed->subtract(ixs);
+	}
+
+	selection = std::make_shared<const ofxPlotRangeSet>(ixs);
+	version++;
+	return true;
+}//====================================================
@@ -0,0 +1,56 @@
+/**
+ * @file ofxPlotSelectionModel.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "ofxPlotRangeSet.hpp"
+
+#include <cstdint>
+#include <memory>
+
+/**
+ *  @brief The current selection shared by a group of linked objects
+ *  @details The selection is stored as an immutable snapshot that is
+ *  replaced on each change, along with a version number that increases
+ *  monotonically. Objects can hold a snapshot without copying it, compare
+ *  versions to detect changes cheaply, and query only the selected indices
+ *  within the range of indices they display.
+ */
+class ofxPlotSelectionModel{
+public:
+	ofxPlotSelectionModel();
+
+	std::shared_ptr<const ofxPlotRangeSet> getSelection() const;
+	void getSelectionInRange(size_t, size_t, ofxPlotRangeSet&) const;
+	uint64_t getVersion() const;
+	bool hasSelectionInRange(size_t, size_t) const;
+
+	bool set(const ofxPlotRangeSet&, ofxPlotRangeSet*, ofxPlotRangeSet*);
+
+protected:
+	std::shared_ptr<const ofxPlotRangeSet> selection;	//!< Current selection; replaced, never modified, on each change
+	uint64_t version = 0;								//!< Incremented each time the selection changes
+};
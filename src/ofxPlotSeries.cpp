@@ -0,0 +1,216 @@
+/**
+ * @file ofxPlotSeries.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotSeries.hpp"
+
+#include <algorithm>
+
+/**
+ *  @brief Add a data point to the series
+ *  @param pt data point
+ */
+void ofxPlotSeries::addDataPt(dataPt pt){
+	if(data.empty()){
+		dataMin = pt;
+		dataMax = pt;
+	}else{
+		expandExtents(pt);
+	}
+
+	data.push_back(pt);
+}//====================================================
+
+/**
+ *  @brief Remove all data, and the per-point attributes, from the series
+ *  @details The style of the series is preserved
+ */
+void ofxPlotSeries::clear(){
+	data.clear();
+	displayData.clear();
+	dataMin = dataPt();
+	dataMax = dataPt();
+
+	bExtentsStale = false;
+	dirtyPts.clear();
+	ptSizes.clear();
+	ptColors.clear();
+
+	bDisplayDataValid = false;
+	vboCount = 0;
+
+	snapshot.reset();
+	snapshotDirtyPts.clear();
+
+	refinement.restart();
+	refinementMesh.clear();
+}//====================================================
+
+/**
+ *  @brief Modify a contiguous span of existing data points
+ *  @details The modified span is recorded in dirtyPts and snapshotDirtyPts.
+ *  The data extents are expanded as needed; they are only flagged for
+ *  recomputation if a point that defined one of the extents moves inward.
+ * 
+ *  @param first index of the first data point to modify
+ *  @param pts new data points
+ *  @return whether or not the span lies within the existing data; if not,
+ *  the series is not modified
+ */
+bool ofxPlotSeries::setDataPts(size_t first, const std::vector<dataPt> &pts){
+	if(first + pts.size() > data.size())
+		return false;
+
+	for(size_t i = 0; i < pts.size(); i++){
+		const dataPt &old = data[first + i];
+		const dataPt &pt = pts[i];
+
+		if((old.indVar == dataMin.indVar && pt.indVar > old.indVar) ||
+			(old.indVar == dataMax.indVar && pt.indVar < old.indVar) ||
+			(old.depVar == dataMin.depVar && pt.depVar > old.depVar) ||
+			(old.depVar == dataMax.depVar && pt.depVar < old.depVar)){
+
+			bExtentsStale = true;
+		}
+
+		expandExtents(pt);
+		data[first + i] = pt;
+	}
+
+	dirtyPts.add(first, first + pts.size());
+	if(snapshot)
+		snapshotDirtyPts.add(first, first + pts.size());
+	return true;
+}//====================================================
+
+/**
+ *  @brief Keep only some of the data points, discarding the rest
+ *  @details The per-point sizes and colors are kept in step with the data.
+ *  The buffers are reallocated to fit so that the discarded points' memory
+ *  is released, and everything derived from the data is invalidated.
+ * 
+ *  @param ixs indices of the points to keep, in ascending order
+ */
+void ofxPlotSeries::retain(const std::vector<size_t> &ixs){
+	bool hasSizes = ptSizes.size() == data.size();
+	bool hasColors = ptColors.size() == data.size();
+
+	std::vector<dataPt> keptData;
+	std::vector<float> keptSizes;
+	std::vector<ofFloatColor> keptColors;
+	keptData.reserve(ixs.size());
+	for(size_t i = 0; i < ixs.size(); i++){
+		keptData.push_back(data[ixs[i]]);
+		if(hasSizes)
+			keptSizes.push_back(ptSizes[ixs[i]]);
+		if(hasColors)
+			keptColors.push_back(ptColors[ixs[i]]);
+	}
+	data.swap(keptData);
+	if(hasSizes)
+		ptSizes.swap(keptSizes);
+	if(hasColors)
+		ptColors.swap(keptColors);
+
+	std::vector<ofVec2f>().swap(displayData);
+	dataPath.clear();
+	bDisplayDataValid = false;
+	bExtentsStale = true;
+	dirtyPts.clear();
+	vboCount = 0;
+
+	snapshot.reset();
+	snapshotDirtyPts.clear();
+
+	refinement.restart();
+	refinementMesh.clear();
+}//====================================================
+
+/**
+ *  @brief Expand the data extents to include a data point
+ *  @param pt data point
+ */
+void ofxPlotSeries::expandExtents(const dataPt &pt){
+	dataMin.indVar = std::min(dataMin.indVar, pt.indVar);
+	dataMin.depVar = std::min(dataMin.depVar, pt.depVar);
+	dataMax.indVar = std::max(dataMax.indVar, pt.indVar);
+	dataMax.depVar = std::max(dataMax.depVar, pt.depVar);
+}//====================================================
+
+/**
+ *  @brief Expand the data extents to include points appended directly to
+ *  the data
+ *  @param first index of the first appended point
+ */
+void ofxPlotSeries::expandExtents(size_t first){
+	if(first == 0 && !data.empty()){
+		dataMin = data.front();
+		dataMax = dataMin;
+	}
+
+	for(size_t i = first; i < data.size(); i++){
+		expandExtents(data[i]);
+	}
+}//====================================================
+
+/**
+ *  @brief Recompute the data extents from scratch
+ *  @details This is only required when a modified point that defined
+ *  one of the extents moves inward
+ */
+void ofxPlotSeries::updateExtents(){
+	dataMin = data.empty() ? dataPt() : data.front();
+	dataMax = dataMin;
+	for(size_t i = 1; i < data.size(); i++){
+		expandExtents(data[i]);
+	}
+	bExtentsStale = false;
+}//====================================================
+
+/**
+ *  @brief Bring the data snapshot up to date
+ *  @details Snapshots are handed to background geometry builds, which read
+ *  them without locking, so a snapshot is never modified while a build still
+ *  holds it; in that case, a new copy is made. Otherwise, only the points
+ *  added or modified since the last update are copied.
+ * 
+ *  @return the snapshot, which matches the data
+ */
+std::shared_ptr<const std::vector<dataPt> > ofxPlotSeries::updateSnapshot(){
+	if(!snapshot || snapshot.use_count() > 1){
+		snapshot = std::make_shared<std::vector<dataPt> >(data);
+	}else{
+		size_t n = snapshot->size();
+		const std::vector<ofxPlotRangeSet::range_t> &ranges = snapshotDirtyPts.getRanges();
+		for(size_t r = 0; r < ranges.size() && ranges[r].first < n; r++){
+			std::copy(data.begin() + ranges[r].first, data.begin() + std::min(ranges[r].second, n),
+				snapshot->begin() + ranges[r].first);
+		}
+		snapshot->insert(snapshot->end(), data.begin() + n, data.end());
+	}
+
+	snapshotDirtyPts.clear();
+	return snapshot;
+}//====================================================
@@ -0,0 +1,95 @@
+/**
+ * @file ofxPlotSeries.hpp
+ * @brief Storage and style for a single data series within a plot
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "dataPt.hpp"
+#include "ofxPlotDecimator.hpp"
+#include "ofxPlotRangeSet.hpp"
+
+#include "ofMain.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations
+class ofxPlotSharedRing;
+
+/**
+ *  @brief A single data series within an ofxPlot
+ *  @details The series stores its data, the extents of the data, and the
+ *  cached geometry derived from the data. All series in a plot share the
+ *  plot's axes, transform, and GPU buffers; each series occupies its own
+ *  block of the shared buffers.
+ */
+struct ofxPlotSeries{
+	
+	void addDataPt(dataPt);
+	void clear();
+	bool setDataPts(size_t, const std::vector<dataPt>&);
+	void expandExtents(const dataPt&);
+	void expandExtents(size_t);
+	void retain(const std::vector<size_t>&);
+	void updateExtents();
+	std::shared_ptr<const std::vector<dataPt> > updateSnapshot();
+
+	std::string name = "";					//!< Name of the series, e.g., for legends
+	
+	std::vector<dataPt> data;				//!< Stores all data values
+	std::vector<ofVec2f> displayData;		//!< Same data, but in screen coordinates (pixels; CPU transform only)
+
+	dataPt dataMin;							//!< Minimum data values, updated as points are added
+	dataPt dataMax;							//!< Maximum data values, updated as points are added
+	bool bExtentsStale = false;				//!< Whether or not a modified point invalidated the extents
+	ofxPlotRangeSet dirtyPts;				//!< Indices of points modified since the geometry was last updated
+
+	ofColor lineColor = ofColor(125, 125, 255, 255);	//!< Color of plotted line or markers
+	float lineWidth = 2;					//!< Plotted data line width
+	float markerSize = 4;					//!< Scatter marker diameter, pixels
+	bool fillPlot = false;					//!< Whether or not to fill the area under the line
+
+	std::vector<float> ptSizes;				//!< Per-point marker diameters; empty to use markerSize
+	std::vector<ofFloatColor> ptColors;		//!< Per-point marker colors; empty to use lineColor
+
+	ofPath dataPath;						//!< Cached path through displayData (CPU transform only)
+	bool bDisplayDataValid = false;			//!< Whether or not displayData and dataPath reflect the current transform
+
+	size_t vboFirst = 0;					//!< Index of the first vertex of this series' block in the shared VBO
+	size_t vboCapacity = 0;					//!< Number of points the block can hold without reallocation
+	size_t vboCount = 0;					//!< Number of points currently uploaded to the block
+
+	std::shared_ptr<std::vector<dataPt> > snapshot;	//!< Copy of the data read by background geometry builds
+	ofxPlotRangeSet snapshotDirtyPts;		//!< Indices of points modified since the snapshot was updated
+
+	std::shared_ptr<ofxPlotSharedRing> ring;	//!< Shared memory ring the series reads new points from; nullptr if none
+	uint64_t ringCursor = 0;				//!< Index of the next sample to read from the ring
+
+	ofxPlotDecimator refinement;			//!< Incremental decimation of the data (progressive refinement only)
+	ofVboMesh refinementMesh;				//!< Refined line, continued through a sample of the unrefined points (progressive refinement only)
+};
@@ -0,0 +1,231 @@
+/**
+ * @file ofxPlotShaders.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotShaders.hpp"
+
+//-----------------------------------------------------------------------------
+// -- Shader Sources --
+//-----------------------------------------------------------------------------
+
+// The vertex stage applies the affine data -> screen map: screen = origin + scale*raw,
+// where raw is the offset-relative data value stored in the VBO. Each vertex carries
+// the index of its series, which selects the series color from a uniform array that
+// covers the window of series [seriesBase, seriesBase + 32); the array length must
+// match ofxPlotShaders::maxBatchSeries
+static const std::string transformVert_GL2 = R"(
+#version 120
+uniform vec2 origin;
+uniform vec2 scale;
+uniform vec4 seriesColors[32];
+uniform int seriesBase;
+attribute float seriesIx;
+varying vec4 lineColor;
+void main(){
+	vec2 screen = origin + scale*gl_Vertex.xy;
+	gl_Position = gl_ModelViewProjectionMatrix * vec4(screen, 0.0, 1.0);
+	lineColor = seriesColors[int(seriesIx + 0.5) - seriesBase];
+}
+)";
+
+static const std::string transformFrag_GL2 = R"(
+#version 120
+varying vec4 lineColor;
+void main(){
+	gl_FragColor = lineColor;
+}
+)";
+
+static const std::string transformVert_GL3 = R"(
+#version 150
+uniform mat4 modelViewProjectionMatrix;
+uniform vec2 origin;
+uniform vec2 scale;
+uniform vec4 seriesColors[32];
+uniform int seriesBase;
+in vec4 position;
+in float seriesIx;
+out vec4 lineColor;
+void main(){
+	vec2 screen = origin + scale*position.xy;
+	gl_Position = modelViewProjectionMatrix * vec4(screen, 0.0, 1.0);
+	lineColor = seriesColors[int(seriesIx + 0.5) - seriesBase];
+}
+)";
+
+static const std::string transformFrag_GL3 = R"(
+#version 150
+in vec4 lineColor;
+out vec4 fragColor;
+void main(){
+	fragColor = lineColor;
+}
+)";
+
+// Scatter markers are point sprites: the vertex stage sizes each point and the
+// fragment stage cuts a disc, with a soft edge, out of the square sprite.
+// Per-point sizes and colors are optional; pointSize <= 0 or pointColor.a < 0
+// select the per-series values instead
+static const std::string scatterVert_GL2 = R"(
+#version 120
+uniform vec2 origin;
+uniform vec2 scale;
+uniform vec4 seriesColors[32];
+uniform float seriesSizes[32];
+uniform int seriesBase;
+uniform int useSizes;
+uniform int useColors;
+attribute float pointSize;
+attribute vec4 pointColor;
+attribute float seriesIx;
+varying vec4 markerColor;
+void main(){
+	int s = int(seriesIx + 0.5) - seriesBase;
+	vec2 screen = origin + scale*gl_Vertex.xy;
+	gl_Position = gl_ModelViewProjectionMatrix * vec4(screen, 0.0, 1.0);
+	gl_PointSize = (useSizes != 0 && pointSize > 0.0) ? pointSize : seriesSizes[s];
+	markerColor = (useColors != 0 && pointColor.a >= 0.0) ? pointColor : seriesColors[s];
+}
+)";
+
+static const std::string scatterFrag_GL2 = R"(
+#version 120
+varying vec4 markerColor;
+void main(){
+	vec2 d = gl_PointCoord - vec2(0.5);
+	float r2 = dot(d, d);
+	if(r2 > 0.25)
+		discard;
+	gl_FragColor = vec4(markerColor.rgb, markerColor.a*(1.0 - smoothstep(0.16, 0.25, r2)));
+}
+)";
+
+static const std::string scatterVert_GL3 = R"(
+#version 150
+uniform mat4 modelViewProjectionMatrix;
+uniform vec2 origin;
+uniform vec2 scale;
+uniform vec4 seriesColors[32];
+uniform float seriesSizes[32];
+uniform int seriesBase;
+uniform int useSizes;
+uniform int useColors;
+in vec4 position;
+in float pointSize;
+in vec4 pointColor;
+in float seriesIx;
+out vec4 markerColor;
+void main(){
+	int s = int(seriesIx + 0.5) - seriesBase;
+	vec2 screen = origin + scale*position.xy;
+	gl_Position = modelViewProjectionMatrix * vec4(screen, 0.0, 1.0);
+	gl_PointSize = (useSizes != 0 && pointSize > 0.0) ? pointSize : seriesSizes[s];
+	markerColor = (useColors != 0 && pointColor.a >= 0.0) ? pointColor : seriesColors[s];
+}
+)";
+
+static const std::string scatterFrag_GL3 = R"(
+#version 150
+in vec4 markerColor;
+out vec4 fragColor;
+void main(){
+	vec2 d = gl_PointCoord - vec2(0.5);
+	float r2 = dot(d, d);
+	if(r2 > 0.25)
+		discard;
+	fragColor = vec4(markerColor.rgb, markerColor.a*(1.0 - smoothstep(0.16, 0.25, r2)));
+}
+)";
+
+//-----------------------------------------------------------------------------
+// -- Setup Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Compile and link a shader from the source strings
+ * 
+ *  @param shader shader object to load
+ *  @param vert vertex shader source
+ *  @param frag fragment shader source
+ *  @param bindPointAttribs whether or not to bind the per-point marker
+ *  attributes to their fixed locations
+ *  @return whether or not the program linked successfully
+ */
+static bool setupFromSource(ofShader &shader, const std::string &vert, const std::string &frag,
+	bool bindPointAttribs = false){
+
+	if(!shader.setupShaderFromSource(GL_VERTEX_SHADER, vert))
+		return false;
+	
+	if(!shader.setupShaderFromSource(GL_FRAGMENT_SHADER, frag))
+		return false;
+
+	if(ofIsGLProgrammableRenderer())
+		shader.bindDefaults();
+
+	shader.bindAttribute(ofxPlotShaders::SERIES_ATTRIBUTE, "seriesIx");
+	if(bindPointAttribs){
+		shader.bindAttribute(ofxPlotShaders::POINT_SIZE_ATTRIBUTE, "pointSize");
+		shader.bindAttribute(ofxPlotShaders::POINT_COLOR_ATTRIBUTE, "pointColor");
+	}
+
+	return shader.linkProgram();
+}//====================================================
+
+/**
+ *  @brief Load the data transform shader
+ *  @details The program expects offset-relative data in the vertex
+ *  position attribute and the series index at SERIES_ATTRIBUTE. It uses
+ *  the uniforms `origin` and `scale` (both vec2, screen pixels),
+ *  `seriesColors` (vec4[maxBatchSeries], normalized RGBA), and
+ *  `seriesBase` (int, index of the series in seriesColors[0])
+ * 
+ *  @param shader shader object to load
+ *  @return whether or not the program linked successfully
+ */
+bool ofxPlotShaders::setupTransform(ofShader &shader){
+	if(ofIsGLProgrammableRenderer())
+		return setupFromSource(shader, transformVert_GL3, transformFrag_GL3);
+	else
+		return setupFromSource(shader, transformVert_GL2, transformFrag_GL2);
+}//====================================================
+
+/**
+ *  @brief Load the scatter (point sprite) shader
+ *  @details In addition to the transform uniforms, the program uses
+ *  `seriesSizes` (float[maxBatchSeries], pixels) and the `useSizes` and `useColors` flags
+ *  (int), which enable the per-point attributes bound at
+ *  POINT_SIZE_ATTRIBUTE and POINT_COLOR_ATTRIBUTE. Point sprites and
+ *  program point sizes must be enabled when drawing.
+ * 
+ *  @param shader shader object to load
+ *  @return whether or not the program linked successfully
+ */
+bool ofxPlotShaders::setupScatter(ofShader &shader){
+	if(ofIsGLProgrammableRenderer())
+		return setupFromSource(shader, scatterVert_GL3, scatterFrag_GL3, true);
+	else
+		return setupFromSource(shader, scatterVert_GL2, scatterFrag_GL2, true);
+}//====================================================
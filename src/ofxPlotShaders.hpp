@@ -0,0 +1,56 @@
+/**
+ * @file ofxPlotShaders.hpp
+ * @brief GLSL programs used by the GPU-side plot rendering paths
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "ofMain.h"
+
+/**
+ *  @brief Collection of the shader programs used by the plot objects
+ *  @details Each program is provided in two flavors: GLSL 1.20 for the
+ *  fixed-function (GL 2.1) renderer and GLSL 1.50 for the programmable
+ *  renderer. Both compile on Mesa's llvmpipe software rasterizer, so the
+ *  GPU paths remain usable in headless environments.
+ */
+class ofxPlotShaders{
+public:
+	/**
+	 *  @brief Vertex attribute locations for per-point data, chosen
+	 *  to follow the openFrameworks default attributes
+	 */
+	enum attributes{
+		POINT_SIZE_ATTRIBUTE = 5,	//!< Marker diameter, pixels (float)
+		POINT_COLOR_ATTRIBUTE = 6,	//!< Marker color, normalized RGBA (vec4)
+		SERIES_ATTRIBUTE = 7		//!< Index of the series that owns the vertex (float)
+	};
+
+	/** Length of the per-series uniform arrays; series are drawn in windows of this size */
+	static const size_t maxBatchSeries = 32;
+
+	static bool setupScatter(ofShader&);
+	static bool setupTransform(ofShader&);
+};
@@ -0,0 +1,392 @@
+/**
+ * @file ofxPlotSharedRing.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotSharedRing.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "ofxPlotSharedRing requires lock-free 64-bit atomics");
+static_assert(offsetof(ofxPlotSharedRingHeader, claimCursor) == 64, "Unexpected shared ring layout");
+static_assert(offsetof(ofxPlotSharedRingHeader, writeCursor) == 128, "Unexpected shared ring layout");
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a closed ring
+ */
+ofxPlotSharedRing::ofxPlotSharedRing(){}
+
+/**
+ *  @brief Unmap the segment
+ *  @details The segment itself is not removed; see remove()
+ */
+ofxPlotSharedRing::~ofxPlotSharedRing(){ close(); }
+
+//-----------------------------------------------------------------------------
+// -- Open and Close --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Unmap the segment, if one is mapped
+ *  @details The segment persists until it is removed, so a producer may
+ *  close and reopen it, or exit and leave the samples for readers
+ */
+void ofxPlotSharedRing::close(){
+#ifndef _WIN32
+	if(segment)
+		munmap(segment, segmentSize);
+#endif
+
+	segment = nullptr;
+	segmentSize = 0;
+	header = nullptr;
+	xs = ys = nullptr;
+	mask = 0;
+	bProducer = false;
+	numDropped = 0;
+}//====================================================
+
+/**
+ *  @brief Create a ring and become its producer
+ *  @details An existing segment with the same name is removed and a new one
+ *  is created in its place, so the old segment is never resized or cleared
+ *  under its readers; readers still attached to it keep reading the old
+ *  segment and must open the ring again to see the new one.
+ * 
+ *  @param n name of the segment; a leading slash is added if missing
+ *  @param capacity samples the ring holds; rounded up to a power of two
+ *  @return whether or not the ring was created; if not, see getError()
+ */
+bool ofxPlotSharedRing::create(const std::string &n, uint64_t capacity){
+	close();
+	name = n.empty() || n[0] != '/' ? "/" + n : n;
+
+	uint64_t cap = 1;
+	while(cap < capacity)
+		cap <<= 1;
+
+#ifdef _WIN32
+	error = "create: Shared memory rings are not supported on Windows";
+	return false;
+#else
+	// Unlink rather than truncate an existing segment: truncating it in place
+	// would zero the header under attached readers, or fault them if it shrank
+	size_t size = getColumnOffset() + 2*cap*sizeof(double);
+	shm_unlink(name.c_str());
+	int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+	if(fd < 0 || ftruncate(fd, size) != 0){
+		error = "create: Could not create " + name + ": " + std::strerror(errno);
+		if(fd >= 0){
+			::close(fd);
+			shm_unlink(name.c_str());
+		}
+		return false;
+	}
+
+	if(!map(fd, size, true)){
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	// Publish the header last, so a reader never sees a valid magic number
+	// with a partial header
+	header->version = version;
+	header->capacity = cap;
+	header->columnOffset = getColumnOffset();
+	header->claimCursor.store(0, std::memory_order_relaxed);
+	header->writeCursor.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	header->magic = magic;
+
+	mask = cap - 1;
+	xs = reinterpret_cast<double*>(static_cast<char*>(segment) + getColumnOffset());
+	ys = xs + cap;
+	bProducer = true;
+	return true;
+#endif
+}//====================================================
+
+/**
+ *  @brief Open an existing ring to read it
+ *  @param n name of the segment; a leading slash is added if missing
+ *  @return whether or not the ring was opened; if not, see getError()
+ */
+bool ofxPlotSharedRing::open(const std::string &n){
+	close();
+	name = n.empty() || n[0] != '/' ? "/" + n : n;
+
+#ifdef _WIN32
+	error = "open: Shared memory rings are not supported on Windows";
+	return false;
+#else
+	int fd = shm_open(name.c_str(), O_RDONLY, 0);
+	struct stat st;
+	if(fd < 0 || fstat(fd, &st) != 0){
+		error = "open: Could not open " + name + ": " + std::strerror(errno);
+		if(fd >= 0)
+			::close(fd);
+		return false;
+	}
+
+	if((size_t)st.st_size < getColumnOffset()){
+		error = "open: " + name + " is too small to be a shared ring";
+		::close(fd);
+		return false;
+	}
+
+	if(!map(fd, st.st_size, false))
+		return false;
+
+	uint64_t cap = header->capacity;
+	if(header->magic != magic || header->version != version || header->columnOffset != getColumnOffset() ||
+		cap == 0 || (cap & (cap - 1)) != 0 || (size_t)st.st_size < getColumnOffset() + 2*cap*sizeof(double)){
+
+		error = "open: " + name + " is not a version " + std::to_string(version) + " shared ring";
+		close();
+		return false;
+	}
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	mask = cap - 1;
+	xs = reinterpret_cast<double*>(static_cast<char*>(segment) + getColumnOffset());
+	ys = xs + cap;
+	return true;
+#endif
+}//====================================================
+
+/**
+ *  @brief Remove a ring's name from the system
+ *  @details Processes that have the ring open may keep using it; its memory
+ *  is released when the last of them closes it
+ *  @param n name of the segment; a leading slash is added if missing
+ *  @return whether or not the name was removed
+ */
+bool ofxPlotSharedRing::remove(const std::string &n){
+#ifdef _WIN32
+	return false;
+#else
+	std::string path = n.empty() || n[0] != '/' ? "/" + n : n;
+	return shm_unlink(path.c_str()) == 0;
+#endif
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Publish and Read --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Publish a single sample
+ * 
+ *  @param x independent variable value
+ *  @param y dependent variable value
+ *  @return whether or not the sample was published
+ *  @see publish(const double*, const double*, size_t)
+ */
+bool ofxPlotSharedRing::publish(double x, double y){
+	return publish(&x, &y, 1);
+}//====================================================
+
+/**
+ *  @brief Publish a batch of samples
+ *  @details Readers see the whole batch at once, so publishing in batches
+ *  is cheaper than publishing samples one at a time. Only the process that
+ *  created the ring may publish, and only from one thread at a time.
+ * 
+ *  @param x independent variable values
+ *  @param y dependent variable values
+ *  @param n number of samples
+ *  @return whether or not the samples were published
+ */
+bool ofxPlotSharedRing::publish(const double *x, const double *y, size_t n){
+	if(!bProducer){
+		error = "publish: Only the process that created the ring may publish to it";
+		return false;
+	}
+
+	uint64_t first = header->writeCursor.load(std::memory_order_relaxed);
+	header->claimCursor.store(first + n, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	for(size_t i = 0; i < n; i++){
+		uint64_t slot = (first + i) & mask;
+		xs[slot] = x[i];
+		ys[slot] = y[i];
+	}
+
+	header->writeCursor.store(first + n, std::memory_order_release);
+	return true;
+}//====================================================
+
+/**
+ *  @brief Read the samples published since a cursor
+ *  @details The samples are appended to a vector, which is the only copy
+ *  made of them. If the producer has published more than a ring's worth of
+ *  samples since the cursor, or overwrites samples while they are being
+ *  copied, the oldest are skipped and counted by getNumDropped().
+ * 
+ *  @param cursor index of the first sample to read; zero to read from the
+ *  oldest sample still in the ring. On return, the index of the next sample
+ *  to read.
+ *  @param out vector the samples are appended to
+ *  @return the number of samples appended
+ */
+size_t ofxPlotSharedRing::read(uint64_t &cursor, std::vector<dataPt> &out){
+	if(!header)
+		return 0;
+
+	uint64_t cap = mask + 1;
+	uint64_t last = header->writeCursor.load(std::memory_order_acquire);
+	if(cursor > last)
+		cursor = 0;		// The cursor belongs to a different ring
+
+	uint64_t first = cursor;
+	if(last - first > cap){
+		if(first > 0)
+			numDropped += last - cap - first;
+		first = last - cap;
+	}
+
+	size_t n0 = out.size();
+	out.resize(n0 + (last - first));
+	for(uint64_t i = first; i < last; i++){
+		uint64_t slot = i & mask;
+		out[n0 + (i - first)] = dataPt(xs[slot], ys[slot]);
+	}
+
+	// Discard samples whose slots the producer may have reused during the copy
+	std::atomic_thread_fence(std::memory_order_acquire);
+	uint64_t claim = header->claimCursor.load(std::memory_order_relaxed);
+	if(claim > first + cap){
+		uint64_t torn = std::min(claim - cap, last) - first;
+		out.erase(out.begin() + n0, out.begin() + n0 + torn);
+		numDropped += torn;
+	}
+
+	cursor = last;
+	return out.size() - n0;
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the capacity
+ *  @return the number of samples the ring holds; zero if it is not open
+ */
+uint64_t ofxPlotSharedRing::getCapacity() const { return header ? mask + 1 : 0; }
+
+/**
+ *  @brief Retrieve a description of the most recent failure
+ *  @return the description; empty if nothing has failed
+ */
+const std::string& ofxPlotSharedRing::getError() const { return error; }
+
+/**
+ *  @brief Retrieve the name of the segment
+ *  @return the name, with a leading slash
+ */
+const std::string& ofxPlotSharedRing::getName() const { return name; }
+
+/**
+ *  @brief Retrieve the number of samples this reader has lost
+ *  @details Samples are lost when the reader falls more than a ring behind
+ *  the producer. Samples that were overwritten before the reader first
+ *  looked at the ring are not counted.
+ *  @return the number of samples lost since the ring was opened
+ */
+uint64_t ofxPlotSharedRing::getNumDropped() const { return numDropped; }
+
+/**
+ *  @brief Retrieve the number of samples published
+ *  @return the number of samples published since the ring was created;
+ *  zero if it is not open
+ */
+uint64_t ofxPlotSharedRing::getWriteCursor() const{
+	return header ? header->writeCursor.load(std::memory_order_acquire) : 0;
+}//====================================================
+
+/**
+ *  @brief Determine whether a ring is mapped
+ *  @return whether or not the ring is open
+ */
+bool ofxPlotSharedRing::isOpen() const { return header != nullptr; }
+
+/**
+ *  @brief Determine whether this process publishes to the ring
+ *  @return whether or not the ring was opened with create()
+ */
+bool ofxPlotSharedRing::isProducer() const { return bProducer; }
+
+//-----------------------------------------------------------------------------
+// -- Utilities --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the byte offset of the x column
+ *  @return the size of the header, rounded up to a cache line
+ */
+uint64_t ofxPlotSharedRing::getColumnOffset(){
+	return (sizeof(ofxPlotSharedRingHeader) + 63)/64*64;
+}//====================================================
+
+/**
+ *  @brief Map an open shared memory object and close its descriptor
+ * 
+ *  @param fd file descriptor of the object
+ *  @param size size of the object, bytes
+ *  @param writable whether or not to map it for writing
+ *  @return whether or not the object was mapped; if not, see getError()
+ */
+bool ofxPlotSharedRing::map(int fd, size_t size, bool writable){
+#ifdef _WIN32
+	return false;
+#else
+	void *ptr = mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if(ptr == MAP_FAILED){
+		error = "map: Could not map " + name + ": " + std::strerror(errno);
+		return false;
+	}
+
+	segment = ptr;
+	segmentSize = size;
+	header = static_cast<ofxPlotSharedRingHeader*>(ptr);
+	return true;
+#endif
+}//====================================================
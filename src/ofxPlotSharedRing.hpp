@@ -0,0 +1,133 @@
+/**
+ * @file ofxPlotSharedRing.hpp
+ * @brief Lock-free ring buffer of samples in POSIX shared memory
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "dataPt.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ *  @brief Header at the start of a shared ring segment
+ *  @details The segment is laid out as follows; every field is in the
+ *  host's byte order, so the producer and consumers must run on the same
+ *  machine (which shared memory requires anyway).
+ * 
+ *  | Offset      | Size | Field                                          |
+ *  |-------------|------|------------------------------------------------|
+ *  | 0           | 4    | magic, 0x5250584F ("OXPR")                     |
+ *  | 4           | 4    | version, 1                                     |
+ *  | 8           | 8    | capacity N, samples per column; a power of two |
+ *  | 16          | 8    | columnOffset, byte offset of the x column (192) |
+ *  | 64          | 8    | claimCursor                                    |
+ *  | 128         | 8    | writeCursor                                    |
+ *  | 192         | 8N   | x column, doubles                              |
+ *  | 192 + 8N    | 8N   | y column, doubles                              |
+ * 
+ *  Sample i (counting from zero since the segment was created) is stored in
+ *  slot i mod N of each column. The cursors count samples and never wrap;
+ *  each sits on its own cache line so that readers polling writeCursor do
+ *  not contend with the producer's other stores.
+ */
+struct ofxPlotSharedRingHeader{
+	uint32_t magic;						//!< Identifies the layout; ofxPlotSharedRing::magic
+	uint32_t version;					//!< Layout version; ofxPlotSharedRing::version
+	uint64_t capacity;					//!< Samples per column; a power of two
+	uint64_t columnOffset;				//!< Byte offset of the x column from the start of the segment
+	alignas(64) std::atomic<uint64_t> claimCursor;	//!< Samples the producer has started to write; at least writeCursor
+	alignas(64) std::atomic<uint64_t> writeCursor;	//!< Samples published; every sample below this index is complete
+};
+
+/**
+ *  @brief Single-producer, multiple-consumer ring buffer of (x, y) samples in
+ *  a named POSIX shared memory segment
+ *  @details One process creates the ring and publishes samples; any number of
+ *  processes open it read-only and read the samples published since they last
+ *  looked. Neither side ever blocks or locks: the producer writes a batch of
+ *  samples, then advances writeCursor with a release store, and readers load
+ *  writeCursor with an acquire load before reading the samples below it.
+ * 
+ *  A reader that falls more than a ring behind loses the oldest samples.
+ *  Because the producer may also overwrite slots while a reader is copying
+ *  them, the producer advances claimCursor before writing, and the reader
+ *  checks claimCursor after copying and discards any sample whose slot may
+ *  have been reused, as with a sequence lock. Lost samples are counted by
+ *  getNumDropped().
+ * 
+ *  This class does not depend on openFrameworks, so a producer process may
+ *  use it on its own (compile ofxPlotSharedRing.cpp into the producer, and
+ *  link with -lrt on older versions of glibc). Shared memory is not
+ *  supported on Windows; create() and open() fail there.
+ *  @see ofxPlot::attachSharedRing()
+ */
+class ofxPlotSharedRing{
+public:
+	static const uint32_t magic = 0x5250584F;	//!< Value of ofxPlotSharedRingHeader::magic
+	static const uint32_t version = 1;			//!< Value of ofxPlotSharedRingHeader::version
+
+	ofxPlotSharedRing();
+	~ofxPlotSharedRing();
+	ofxPlotSharedRing(const ofxPlotSharedRing&) = delete;
+	ofxPlotSharedRing& operator=(const ofxPlotSharedRing&) = delete;
+
+	void close();
+	bool create(const std::string&, uint64_t);
+	bool open(const std::string&);
+	static bool remove(const std::string&);
+
+	bool publish(double, double);
+	bool publish(const double*, const double*, size_t);
+	size_t read(uint64_t&, std::vector<dataPt>&);
+
+	uint64_t getCapacity() const;
+	const std::string& getError() const;
+	const std::string& getName() const;
+	uint64_t getNumDropped() const;
+	uint64_t getWriteCursor() const;
+	bool isOpen() const;
+	bool isProducer() const;
+
+protected:
+	std::string name = "";							//!< Name of the segment, e.g., "/telemetry"
+	std::string error = "";							//!< Description of the most recent failure
+	void *segment = nullptr;						//!< Start of the mapped segment; nullptr if closed
+	size_t segmentSize = 0;							//!< Size of the mapping, bytes
+	ofxPlotSharedRingHeader *header = nullptr;		//!< Header at the start of the segment
+	double *xs = nullptr;							//!< x column
+	double *ys = nullptr;							//!< y column
+	uint64_t mask = 0;								//!< Capacity minus one; maps a sample index to its slot
+	bool bProducer = false;							//!< Whether or not this process created the ring and may publish to it
+	uint64_t numDropped = 0;						//!< Samples this reader lost to overruns
+
+	static uint64_t getColumnOffset();
+	bool map(int, size_t, bool);
+};
@@ -0,0 +1,258 @@
+/**
+ * @file ofxPlotStats.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "ofxPlotStats.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct an empty set of statistics
+ */
+ofxPlotStats::ofxPlotStats(){
+	reset();
+}//====================================================
+
+/**
+ *  @brief Start timing a scope
+ *  @param s statistics to record to
+ *  @param t timer to add to
+ */
+ofxPlotStats::ScopedTimer::ScopedTimer(ofxPlotStats &s, Timer t) : stats(s.isEnabled() ? &s : nullptr), timer(t){
+	if(stats)
+		start = std::chrono::steady_clock::now();
+}//====================================================
+
+/**
+ *  @brief Stop timing the scope and record the elapsed time
+ */
+ofxPlotStats::ScopedTimer::~ScopedTimer(){
+	if(stats){
+		stats->addTime(timer, std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start).count());
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Record --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Add to a counter for the current frame
+ * 
+ *  @param c counter
+ *  @param n amount to add
+ */
+void ofxPlotStats::add(Counter c, uint64_t n){
+	sync();
+	counts[c] += n;
+	totals[c] += n;
+}//====================================================
+
+/**
+ *  @brief Add to a timer for the current frame
+ * 
+ *  @param t timer
+ *  @param ns time to add, nanoseconds
+ */
+void ofxPlotStats::addTime(Timer t, uint64_t ns){
+	sync();
+	times[t] += ns;
+}//====================================================
+
+/**
+ *  @brief Set a counter for the current frame, e.g., one that describes
+ *  a quantity rather than an amount of work
+ * 
+ *  @param c counter
+ *  @param n value
+ */
+void ofxPlotStats::set(Counter c, uint64_t n){
+	sync();
+	counts[c] = n;
+}//====================================================
+
+/**
+ *  @brief Make the current values the values of the last frame
+ *  @details This happens automatically when the frame number changes; call
+ *  it directly when frames are not counted by openFrameworks
+ */
+void ofxPlotStats::endFrame(){
+	for(int c = 0; c < NUM_COUNTERS; c++){
+		lastCounts[c] = counts[c];
+		counts[c] = 0;
+	}
+
+	for(int t = 0; t < NUM_TIMERS; t++){
+		lastTimes[t] = times[t];
+		avgTimes[t] = 0.9*avgTimes[t] + 0.1*times[t];
+		times[t] = 0;
+	}
+
+	frame = ofGetFrameNum();
+}//====================================================
+
+/**
+ *  @brief Clear all statistics
+ */
+void ofxPlotStats::reset(){
+	std::fill(counts, counts + NUM_COUNTERS, 0);
+	std::fill(lastCounts, lastCounts + NUM_COUNTERS, 0);
+	std::fill(totals, totals + NUM_COUNTERS, 0);
+	std::fill(times, times + NUM_TIMERS, 0);
+	std::fill(lastTimes, lastTimes + NUM_TIMERS, 0);
+	std::fill(avgTimes, avgTimes + NUM_TIMERS, 0.0);
+	frame = ofGetFrameNum();
+}//====================================================
+
+/**
+ *  @brief End the current frame if a new one has begun
+ */
+void ofxPlotStats::sync(){
+	if(ofGetFrameNum() != frame)
+		endFrame();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Graphics --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Draw the statistics of the last frame as a compact overlay
+ *  @param area area to draw in, e.g., the widget's viewport; the overlay
+ *  is drawn in its top-left corner
+ */
+void ofxPlotStats::draw(const ofRectangle &area) const{
+	std::string str = toString();
+	size_t lines = std::count(str.begin(), str.end(), '\n') + 1;
+
+	ofPushStyle();
+	ofFill();
+	ofSetColor(0, 0, 0, 160);
+	ofDrawRectangle(area.x, area.y, std::min(area.width, 290.f), 14*lines + 6);
+	ofSetColor(255);
+	ofDrawBitmapString(str, area.x + 4, area.y + 14);
+	ofPopStyle();
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve the smoothed time spent in a phase per frame
+ *  @param t timer
+ *  @return the smoothed time, microseconds
+ */
+double ofxPlotStats::getAverageTime(Timer t) const { return avgTimes[t]/1000; }
+
+/**
+ *  @brief Retrieve a counter's value for the last frame
+ *  @param c counter
+ *  @return the value
+ */
+uint64_t ofxPlotStats::getCount(Counter c) const { return lastCounts[c]; }
+
+/**
+ *  @brief Retrieve the time spent in a phase during the last frame
+ *  @param t timer
+ *  @return the time, microseconds
+ */
+double ofxPlotStats::getTime(Timer t) const { return lastTimes[t]/1000.0; }
+
+/**
+ *  @brief Retrieve a counter's value summed over all frames
+ *  @details Only amounts passed to add() are summed
+ *  @param c counter
+ *  @return the sum
+ */
+uint64_t ofxPlotStats::getTotal(Counter c) const { return totals[c]; }
+
+/**
+ *  @brief Determine whether statistics are recorded
+ *  @return whether or not statistics are recorded; always false if
+ *  instrumentation is compiled out
+ */
+bool ofxPlotStats::isEnabled() const { return OFXPLOT_STATS && bEnabled; }
+
+/**
+ *  @brief Tell the statistics whether to record
+ *  @param enabled whether or not to record statistics
+ */
+void ofxPlotStats::setEnabled(bool enabled){ bEnabled = enabled; }
+
+/**
+ *  @brief Describe the statistics of the last frame
+ *  @return a short, multi-line description
+ */
+std::string ofxPlotStats::toString() const{
+	char buf[256];
+	snprintf(buf, sizeof(buf),
+		"pts %llu stored, %llu drawn\n"
+		"alloc %llu (%llu total)\n"
+		"events %.2f  extents %.2f ms\n"
+		"xform %.2f  mesh %.2f  submit %.2f ms",
+		(unsigned long long)lastCounts[PTS_STORED], (unsigned long long)lastCounts[PTS_DRAWN],
+		(unsigned long long)lastCounts[ALLOCATIONS], (unsigned long long)totals[ALLOCATIONS],
+		avgTimes[EVENTS]/1e6, avgTimes[EXTENTS]/1e6,
+		avgTimes[TRANSFORM]/1e6, avgTimes[MESH]/1e6, avgTimes[SUBMIT]/1e6);
+	return buf;
+}//====================================================
+
+/**
+ *  @brief Retrieve the name of a counter
+ *  @param c counter
+ *  @return the name
+ */
+std::string ofxPlotStats::getName(Counter c){
+	switch(c){
+		case PTS_STORED: return "points stored";
+		case PTS_DRAWN: return "points drawn";
+		case ALLOCATIONS: return "allocations";
+		default: return "unknown";
+	}
+}//====================================================
+
+/**
+ *  @brief Retrieve the name of a timer
+ *  @param t timer
+ *  @return the name
+ */
+std::string ofxPlotStats::getName(Timer t){
+	switch(t){
+		case EVENTS: return "events";
+		case EXTENTS: return "extents";
+		case TRANSFORM: return "transform";
+		case MESH: return "mesh build";
+		case SUBMIT: return "GL submit";
+		default: return "unknown";
+	}
+}//====================================================
@@ -0,0 +1,144 @@
+/**
+ * @file ofxPlotStats.hpp
+ * @brief Lightweight per-widget counters and timers
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ *  Set OFXPLOT_STATS to 0 (e.g., -DOFXPLOT_STATS=0) to compile out all
+ *  instrumentation; the statistics then always read zero
+ */
+#ifndef OFXPLOT_STATS
+#define OFXPLOT_STATS 1
+#endif
+
+#define OFXPLOT_STATS_CONCAT_(a, b) a##b
+#define OFXPLOT_STATS_CONCAT(a, b) OFXPLOT_STATS_CONCAT_(a, b)
+
+#if OFXPLOT_STATS
+/** Time the rest of the enclosing scope */
+#define OFXPLOT_TIME(stats, timer) \
+	ofxPlotStats::ScopedTimer OFXPLOT_STATS_CONCAT(ofxPlotStatsTimer_, __LINE__)(stats, timer)
+/** Add to a counter; the value is not evaluated if statistics are disabled */
+#define OFXPLOT_COUNT(stats, counter, n) \
+	do{ if((stats).isEnabled()) (stats).add(counter, n); }while(0)
+/** Set a counter; the value is not evaluated if statistics are disabled */
+#define OFXPLOT_SET(stats, counter, n) \
+	do{ if((stats).isEnabled()) (stats).set(counter, n); }while(0)
+#else
+#define OFXPLOT_TIME(stats, timer)
+#define OFXPLOT_COUNT(stats, counter, n) do{}while(0)
+#define OFXPLOT_SET(stats, counter, n) do{}while(0)
+#endif
+
+/**
+ *  @brief Counters and timers that describe the work a widget does each frame
+ *  @details Values are accumulated over a frame; when a new frame begins (the
+ *  frame number changes, or endFrame() is called) they become the values of
+ *  the last frame, which are what the getters report. Timers also keep a
+ *  smoothed average for display. Recording costs a branch when disabled, a
+ *  couple of clock reads per timed scope when enabled, and nothing when
+ *  compiled out. A widget's statistics are only recorded by the thread
+ *  working on that widget, so no locking is done.
+ */
+class ofxPlotStats{
+public:
+	/**
+	 *  @brief Phases that are timed
+	 */
+	enum Timer{
+		EVENTS,			//!< Event handlers, including deferred input processing
+		EXTENTS,		//!< Computing the data extents
+		TRANSFORM,		//!< Transforming, binning, or decimating the data
+		MESH,			//!< Building paths and meshes
+		SUBMIT,			//!< Uploading data and issuing draw calls (CPU time, not GPU time)
+		NUM_TIMERS
+	};
+
+	/**
+	 *  @brief Quantities that are counted
+	 */
+	enum Counter{
+		PTS_STORED,		//!< Data points held by the widget
+		PTS_DRAWN,		//!< Data vertices submitted for drawing
+		ALLOCATIONS,	//!< Large buffer allocations: GPU buffers, textures, FBOs, data copies
+		NUM_COUNTERS
+	};
+
+	/**
+	 *  @brief Adds the time between its construction and destruction to a timer
+	 */
+	class ScopedTimer{
+	public:
+		ScopedTimer(ofxPlotStats&, Timer);
+		~ScopedTimer();
+
+	protected:
+		ofxPlotStats *stats;	//!< Statistics to record to; nullptr if disabled
+		Timer timer;			//!< Timer to add to
+		std::chrono::steady_clock::time_point start;	//!< Time the scope was entered
+	};
+
+	ofxPlotStats();
+
+	void add(Counter, uint64_t);
+	void addTime(Timer, uint64_t);
+	void draw(const ofRectangle&) const;
+	void endFrame();
+	void reset();
+	void set(Counter, uint64_t);
+
+	double getAverageTime(Timer) const;
+	uint64_t getCount(Counter) const;
+	double getTime(Timer) const;
+	uint64_t getTotal(Counter) const;
+	bool isEnabled() const;
+	void setEnabled(bool);
+	std::string toString() const;
+
+	static std::string getName(Counter);
+	static std::string getName(Timer);
+
+protected:
+	bool bEnabled = true;					//!< Whether or not statistics are recorded
+	uint64_t frame = 0;						//!< Frame the current values belong to
+
+	uint64_t counts[NUM_COUNTERS];			//!< Counter values for the current frame
+	uint64_t lastCounts[NUM_COUNTERS];		//!< Counter values for the last frame
+	uint64_t totals[NUM_COUNTERS];			//!< Counter values summed over all frames
+	uint64_t times[NUM_TIMERS];				//!< Timer values for the current frame, nanoseconds
+	uint64_t lastTimes[NUM_TIMERS];			//!< Timer values for the last frame, nanoseconds
+	double avgTimes[NUM_TIMERS];			//!< Smoothed timer values, nanoseconds
+
+	void sync();
+};
@@ -0,0 +1,214 @@
+/**
+ * @file ofxPlotThreadPool.cpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ofxPlotThreadPool.hpp"
+
+#include "ofMain.h"
+
+#include <exception>
+
+//-----------------------------------------------------------------------------
+// -- *structors --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Construct a pool and start its worker threads
+ *  @param n number of worker threads; zero uses one fewer than the number
+ *  of cores, since the thread that calls parallelFor() also runs tasks
+ */
+ofxPlotThreadPool::ofxPlotThreadPool(size_t n) : numQueued(0), nextQueue(0), bStop(false){
+	if(n == 0){
+		unsigned int cores = std::thread::hardware_concurrency();
+		n = cores > 1 ? cores - 1 : 1;
+	}
+
+	for(size_t i = 0; i < n; i++){
+		queues.push_back(std::unique_ptr<Queue>(new Queue()));
+	}
+
+	for(size_t i = 0; i < n; i++){
+		workers.push_back(std::thread(&ofxPlotThreadPool::workerLoop, this, i));
+	}
+}//====================================================
+
+/**
+ *  @brief Stop the worker threads
+ *  @details Workers finish the task they are running; tasks that have not
+ *  started are discarded
+ */
+ofxPlotThreadPool::~ofxPlotThreadPool(){
+	{
+		std::lock_guard<std::mutex> lock(sleepMtx);
+		bStop = true;
+	}
+	wake.notify_all();
+
+	for(size_t i = 0; i < workers.size(); i++){
+		workers[i].join();
+	}
+}//====================================================
+
+//-----------------------------------------------------------------------------
+// -- Set and Get Functions --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Retrieve a pool shared by the whole application
+ *  @details The pool is created on first use with the default number of
+ *  threads
+ *  @return pointer to the shared pool
+ */
+std::shared_ptr<ofxPlotThreadPool> ofxPlotThreadPool::getShared(){
+	static std::shared_ptr<ofxPlotThreadPool> pool = std::make_shared<ofxPlotThreadPool>();
+	return pool;
+}//====================================================
+
+/**
+ *  @brief Retrieve the number of worker threads
+ *  @return the number of worker threads
+ */
+size_t ofxPlotThreadPool::getNumThreads() const { return workers.size(); }
+
+//-----------------------------------------------------------------------------
+// -- Run Tasks --
+//-----------------------------------------------------------------------------
+
+/**
+ *  @brief Run a function for each index in [0, n) and wait for all of
+ *  them to finish
+ *  @details The calling thread runs tasks while it waits. The function must
+ *  be safe to call concurrently for different indices. Exceptions are
+ *  caught and logged so that one failure does not abandon the others.
+ * 
+ *  @param n number of indices
+ *  @param fn function to call with each index
+ */
+void ofxPlotThreadPool::parallelFor(size_t n, const std::function<void(size_t)> &fn){
+	if(n == 0)
+		return;
+
+	struct Batch{
+		std::atomic<size_t> remaining;
+		std::mutex mtx;
+		std::condition_variable done;
+	};
+	std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+	batch->remaining = n;
+
+	for(size_t i = 0; i < n; i++){
+		submit([batch, &fn, i](){
+			try{
+				fn(i);
+			}catch(const std::exception &e){
+				ofLogWarning("ofxPlotThreadPool") << "parallelFor: task " << i << " threw: " << e.what();
+			}
+
+			if(--batch->remaining == 0){
+				std::lock_guard<std::mutex> lock(batch->mtx);
+				batch->done.notify_all();
+			}
+		});
+	}
+
+	// Help with the work, then wait for tasks that other threads are running
+	while(batch->remaining > 0){
+		if(!runOne(queues.size())){
+			std::unique_lock<std::mutex> lock(batch->mtx);
+			batch->done.wait_for(lock, std::chrono::microseconds(100), [&batch](){ return batch->remaining == 0; });
+		}
+	}
+}//====================================================
+
+/**
+ *  @brief Queue a task to run on a worker thread
+ *  @param task function to run; it must not throw
+ */
+void ofxPlotThreadPool::submit(std::function<void()> task){
+	size_t q = nextQueue++ % queues.size();
+	{
+		std::lock_guard<std::mutex> lock(queues[q]->mtx);
+		queues[q]->tasks.push_back(std::move(task));
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMtx);
+		numQueued++;
+	}
+	wake.notify_one();
+}//====================================================
+
+/**
+ *  @brief Run a single task, if one is available
+ *  @details The newest task in the thread's own queue is preferred; otherwise,
+ *  the oldest task is stolen from another queue
+ * 
+ *  @param self index of the calling worker's queue, or the number of queues
+ *  if the caller is not a worker
+ *  @return whether or not a task was run
+ */
+bool ofxPlotThreadPool::runOne(size_t self){
+	std::function<void()> task;
+
+	if(self < queues.size()){
+		std::lock_guard<std::mutex> lock(queues[self]->mtx);
+		if(!queues[self]->tasks.empty()){
+			task = std::move(queues[self]->tasks.back());
+			queues[self]->tasks.pop_back();
+		}
+	}
+
+	for(size_t i = 1; !task && i <= queues.size(); i++){
+		Queue &victim = *queues[(self + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mtx);
+		if(!victim.tasks.empty()){
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+		}
+	}
+
+	if(!task)
+		return false;
+
+	numQueued--;
+	task();
+	return true;
+}//====================================================
+
+/**
+ *  @brief Run tasks until the pool stops
+ *  @param self index of this worker's queue
+ */
+void ofxPlotThreadPool::workerLoop(size_t self){
+	while(true){
+		if(runOne(self))
+			continue;
+
+		std::unique_lock<std::mutex> lock(sleepMtx);
+		wake.wait(lock, [this](){ return bStop || numQueued > 0; });
+		if(bStop)
+			return;
+	}
+}//====================================================
@@ -0,0 +1,79 @@
+/**
+ * @file ofxPlotThreadPool.hpp
+ * 
+ * @author Andrew Cox
+ * @version July 5, 2016
+ * 
+ * Copyright (c) 2016 Andrew Cox
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in 
+ * the Software without restriction, including without limitation the rights to use, 
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to do so, subject 
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies 
+ * or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+ * THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ *  @brief A fixed set of worker threads that share work by stealing
+ *  @details Each worker owns a task queue. Tasks are distributed across the
+ *  queues as they are submitted; a worker runs the newest task in its own
+ *  queue and, when that queue is empty, steals the oldest task from another
+ *  worker's queue, so uneven tasks (e.g., one large plot among many small
+ *  ones) do not leave threads idle. A thread that waits on parallelFor()
+ *  helps run tasks rather than blocking.
+ */
+class ofxPlotThreadPool{
+public:
+	ofxPlotThreadPool(size_t = 0);
+	~ofxPlotThreadPool();
+
+	static std::shared_ptr<ofxPlotThreadPool> getShared();
+
+	size_t getNumThreads() const;
+	void parallelFor(size_t, const std::function<void(size_t)>&);
+	void submit(std::function<void()>);
+
+protected:
+	/**
+	 *  @brief Task queue owned by a single worker
+	 */
+	struct Queue{
+		std::deque<std::function<void()> > tasks;	//!< Pending tasks; the owner takes from the back, thieves from the front
+		std::mutex mtx;								//!< Guards tasks
+	};
+
+	std::vector<std::unique_ptr<Queue> > queues;	//!< One queue per worker
+	std::vector<std::thread> workers;				//!< Worker threads
+
+	std::mutex sleepMtx;					//!< Guards sleeping workers
+	std::condition_variable wake;			//!< Signaled when tasks are submitted or the pool stops
+	std::atomic<size_t> numQueued;			//!< Number of tasks waiting in any queue
+	std::atomic<size_t> nextQueue;			//!< Queue that receives the next submitted task
+	std::atomic<bool> bStop;				//!< Whether or not the workers should exit
+
+	bool runOne(size_t);
+	void workerLoop(size_t);
+};